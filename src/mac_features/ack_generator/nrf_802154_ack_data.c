@@ -38,6 +38,7 @@
 #include "nrf_802154_ack_data.h"
 
 #include <assert.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "mac_features/nrf_802154_frame_parser.h"
@@ -48,16 +49,26 @@
 #define NUM_SHORT_ADDRESSES    NRF_802154_PENDING_SHORT_ADDRESSES
 /// Maximum number of Extended Addresses of nodes for which there is ACK data to set.
 #define NUM_EXTENDED_ADDRESSES NRF_802154_PENDING_EXTENDED_ADDRESSES
-
-/// Structure representing pending bit setting variables.
-typedef struct
-{
-    bool     enabled;                                                      /// If setting pending bit is enabled.
-    uint8_t  short_addr[NUM_SHORT_ADDRESSES][SHORT_ADDRESS_SIZE];          /// Array of short addresses of nodes for which there is pending data in the buffer.
-    uint8_t  extended_addr[NUM_EXTENDED_ADDRESSES][EXTENDED_ADDRESS_SIZE]; /// Array of extended addresses of nodes for which there is pending data in the buffer.
-    uint32_t num_of_short_addr;                                            /// Current number of short addresses of nodes for which there is pending data in the buffer.
-    uint32_t num_of_ext_addr;                                              /// Current number of extended addresses of nodes for which there is pending data in the buffer.
-} pending_bit_arrays_t;
+/// Number of types of ACK data that can be set for a node.
+#define NUM_ACK_DATA_TYPES     2
+/// Maximum number of nodes with Short Address for which any ACK data is set.
+#define NUM_SHORT_NEIGHBORS    (NUM_SHORT_ADDRESSES * NUM_ACK_DATA_TYPES)
+/// Maximum number of nodes with Extended Address for which any ACK data is set.
+#define NUM_EXTENDED_NEIGHBORS (NUM_EXTENDED_ADDRESSES * NUM_ACK_DATA_TYPES)
+
+#if NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+/// Number of slots for Short Addresses. Hash table load factor is kept at or below 50%.
+#define NUM_SHORT_SLOTS        (NUM_SHORT_NEIGHBORS * 2)
+/// Number of slots for Extended Addresses. Hash table load factor is kept at or below 50%.
+#define NUM_EXTENDED_SLOTS     (NUM_EXTENDED_NEIGHBORS * 2)
+/// Multiplier of Fibonacci hashing.
+#define HASH_MULTIPLIER        2654435769UL
+#else
+/// Number of slots for Short Addresses.
+#define NUM_SHORT_SLOTS        NUM_SHORT_NEIGHBORS
+/// Number of slots for Extended Addresses.
+#define NUM_EXTENDED_SLOTS     NUM_EXTENDED_NEIGHBORS
+#endif
 
 // Structure representing a single IE record.
 typedef struct
@@ -66,32 +77,41 @@ typedef struct
     uint8_t len;                                /// Length of the buffer.
 } ie_data_t;
 
-// Structure representing IE records sent in an ACK message to a given short address.
+// Structure representing ACK data set for a single node.
 typedef struct
 {
-    uint8_t   addr[SHORT_ADDRESS_SIZE]; /// Short address of peer node.
-    ie_data_t ie_data;                  /// Pointer to IE records.
-} ack_short_ie_data_t;
+    uint8_t   flags;   /// Bit mask of ACK data types set for the node, indexed by @ref nrf_802154_ack_data_t.
+    ie_data_t ie_data; /// IE records sent in an ACK message to the node.
+} neighbor_data_t;
 
-// Structure representing IE records sent in an ACK message to a given extended address.
+// Structure representing ACK data set for a node with a short address.
 typedef struct
 {
-    uint8_t   addr[EXTENDED_ADDRESS_SIZE]; /// Extended address of peer node.
-    ie_data_t ie_data;                     /// Pointer to IE records.
-} ack_ext_ie_data_t;
+    uint8_t         addr[SHORT_ADDRESS_SIZE]; /// Short address of peer node.
+    neighbor_data_t data;                     /// ACK data set for the peer node.
+} neighbor_short_t;
 
-// Structure representing IE data setting variables.
+// Structure representing ACK data set for a node with an extended address.
 typedef struct
 {
-    ack_short_ie_data_t short_data[NUM_SHORT_ADDRESSES];  /// Array of short addresses and IE records sent to these addresses.
-    ack_ext_ie_data_t   ext_data[NUM_EXTENDED_ADDRESSES]; /// Array of extended addresses and IE records sent to these addresses.
-    uint32_t            num_of_short_data;                /// Current number of short addresses stored in @p short_data.
-    uint32_t            num_of_ext_data;                  /// Current number of extended addresses stored in @p ext_data.
-} ie_arrays_t;
+    uint8_t         addr[EXTENDED_ADDRESS_SIZE]; /// Extended address of peer node.
+    neighbor_data_t data;                        /// ACK data set for the peer node.
+} neighbor_ext_t;
 
-// TODO: Combine below arrays to perform binary search only once per Ack generation.
-static pending_bit_arrays_t        m_pending_bit;
-static ie_arrays_t                 m_ie;
+/// Structure representing ACK data setting variables.
+typedef struct
+{
+    bool             enabled;                               /// If setting pending bit is enabled.
+    neighbor_short_t short_addr[NUM_SHORT_SLOTS];           /// Array of short addresses of nodes for which there is ACK data.
+    neighbor_ext_t   extended_addr[NUM_EXTENDED_SLOTS];     /// Array of extended addresses of nodes for which there is ACK data.
+    uint32_t         num_of_short_addr;                     /// Current number of entries in @p short_addr.
+    uint32_t         num_of_ext_addr;                       /// Current number of entries in @p extended_addr.
+    uint32_t         num_of_short_data[NUM_ACK_DATA_TYPES]; /// Current number of entries in @p short_addr with given type of data set.
+    uint32_t         num_of_ext_data[NUM_ACK_DATA_TYPES];   /// Current number of entries in @p extended_addr with given type of data set.
+} neighbor_arrays_t;
+
+// Pending bit and IE data are kept in a single table so that one search serves Ack generation.
+static neighbor_arrays_t           m_neighbors;
 static nrf_802154_src_addr_match_t m_src_matching_method;
 
 /***************************************************************************************************
@@ -187,10 +207,516 @@ static int8_t addr_compare(const uint8_t * p_first_addr,
 }
 
 /**
- * @brief Perform a binary search for an address in a list of addresses.
+ * @brief Get the bit mask representing a given type of ACK data in @ref neighbor_data_t.
+ *
+ * @param[in]  data_type  Type of ACK data.
+ *
+ * @return  Bit mask of @p data_type.
+ */
+static inline uint8_t data_flag_get(uint8_t data_type)
+{
+    return (uint8_t)(1U << data_type);
+}
+
+/**
+ * @brief Get the array of neighbors with addresses of a given length.
+ *
+ * @param[in]  extended  Indication if the array of extended or short addresses is requested.
+ *
+ * @return  Pointer to the first entry of the array.
+ */
+static inline uint8_t * neighbor_array_get(bool extended)
+{
+    return extended ? (uint8_t *)m_neighbors.extended_addr : (uint8_t *)m_neighbors.short_addr;
+}
+
+/**
+ * @brief Get the size of a single entry in the array of neighbors.
+ *
+ * @param[in]  extended  Indication if the array of extended or short addresses is used.
+ *
+ * @return  Size of the entry in bytes.
+ */
+static inline uint8_t neighbor_entry_size_get(bool extended)
+{
+    return extended ? sizeof(neighbor_ext_t) : sizeof(neighbor_short_t);
+}
+
+/**
+ * @brief Get the address stored in the neighbor table at a given location.
+ *
+ * @param[in]  location  Index of the entry in the neighbor table.
+ * @param[in]  extended  Indication if the array of extended or short addresses is used.
+ *
+ * @return  Pointer to the address of the neighbor.
+ */
+static inline uint8_t * neighbor_addr_get(uint32_t location, bool extended)
+{
+    return neighbor_array_get(extended) + neighbor_entry_size_get(extended) * location;
+}
+
+/**
+ * @brief Get ACK data stored in the neighbor table at a given location.
+ *
+ * @param[in]  location  Index of the entry in the neighbor table.
+ * @param[in]  extended  Indication if the array of extended or short addresses is used.
+ *
+ * @return  Pointer to ACK data of the neighbor.
+ */
+static inline neighbor_data_t * neighbor_data_get(uint32_t location, bool extended)
+{
+    return extended ? &m_neighbors.extended_addr[location].data :
+           &m_neighbors.short_addr[location].data;
+}
+
+/**
+ * @brief Get the counter of neighbors with given type of ACK data set.
+ *
+ * @param[in]  data_type  Type of ACK data.
+ * @param[in]  extended   Indication if the counter for extended or short addresses is requested.
+ *
+ * @return  Pointer to the counter.
+ */
+static inline uint32_t * num_of_data_get(uint8_t data_type, bool extended)
+{
+    return extended ? &m_neighbors.num_of_ext_data[data_type] :
+           &m_neighbors.num_of_short_data[data_type];
+}
+
+static void ie_data_add(uint32_t location, bool extended, const uint8_t * p_data, uint8_t data_len)
+{
+    ie_data_t * p_ie_data = &neighbor_data_get(location, extended)->ie_data;
+
+    memcpy(p_ie_data->p_data, p_data, data_len);
+    p_ie_data->len = data_len;
+}
+
+/**
+ * @brief Compare two short addresses for sorting with qsort.
+ *
+ * @param[in]  p_first   Pointer to a first address that should be compared.
+ * @param[in]  p_second  Pointer to a second address that should be compared.
+ *
+ * @return  Negative, zero or positive value if the first address is less than, equal to or
+ *          greater than the second address, respectively.
+ */
+static int short_addr_sort_compare(const void * p_first, const void * p_second)
+{
+    return short_addr_compare((const uint8_t *)p_first, (const uint8_t *)p_second);
+}
+
+/**
+ * @brief Compare two extended addresses for sorting with qsort.
+ *
+ * @param[in]  p_first   Pointer to a first address that should be compared.
+ * @param[in]  p_second  Pointer to a second address that should be compared.
+ *
+ * @return  Negative, zero or positive value if the first address is less than, equal to or
+ *          greater than the second address, respectively.
+ */
+static int extended_addr_sort_compare(const void * p_first, const void * p_second)
+{
+    return extended_addr_compare((const uint8_t *)p_first, (const uint8_t *)p_second);
+}
+
+/**
+ * @brief Check if an address in a sorted array of addresses repeats the preceding one.
+ *
+ * @param[in]  p_addrs   Pointer to the sorted array of addresses.
+ * @param[in]  index     Index of the address to check.
+ * @param[in]  extended  Indication if @p p_addrs contains extended or short addresses.
+ *
+ * @retval true   Address at @p index is equal to the address at @p index - 1.
+ * @retval false  Address at @p index is the first occurrence of this address.
+ */
+static bool addr_is_duplicate(const uint8_t * p_addrs, uint32_t index, bool extended)
+{
+    uint8_t addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+    return (index > 0) &&
+           (addr_compare(p_addrs + addr_size * index,
+                         p_addrs + addr_size * (index - 1),
+                         extended) == 0);
+}
+
+#if NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+
+/***************************************************************************************************
+ * @section Hash table storage
+ **************************************************************************************************/
+
+/**
+ * @brief Get the number of slots in the neighbor table.
+ *
+ * @param[in]  extended  Indication if the table of extended or short addresses is used.
+ *
+ * @return  Number of slots.
+ */
+static inline uint32_t num_of_slots_get(bool extended)
+{
+    return extended ? NUM_EXTENDED_SLOTS : NUM_SHORT_SLOTS;
+}
+
+/**
+ * @brief Get the index of the slot following a given one.
+ *
+ * @param[in]  location  Index of the slot.
+ * @param[in]  extended  Indication if the table of extended or short addresses is used.
+ *
+ * @return  Index of the next slot, wrapping around the end of the table.
+ */
+static inline uint32_t slot_next_get(uint32_t location, bool extended)
+{
+    location++;
+
+    return (location == num_of_slots_get(extended)) ? 0 : location;
+}
+
+/**
+ * @brief Get the distance from slot @p from to slot @p to in the probing order.
+ *
+ * @param[in]  from      Index of the first slot.
+ * @param[in]  to        Index of the second slot.
+ * @param[in]  extended  Indication if the table of extended or short addresses is used.
+ *
+ * @return  Number of probes needed to get from @p from to @p to.
+ */
+static inline uint32_t slot_distance_get(uint32_t from, uint32_t to, bool extended)
+{
+    return (to >= from) ? (to - from) : (to + num_of_slots_get(extended) - from);
+}
+
+/**
+ * @brief Compute the home slot of an address.
+ *
+ * @param[in]  p_addr    Pointer to the address.
+ * @param[in]  extended  Indication if @p p_addr is an extended or a short addresses.
+ *
+ * @return  Index of the slot at which probing for @p p_addr starts.
+ */
+static uint32_t addr_hash(const uint8_t * p_addr, bool extended)
+{
+    uint32_t key;
+
+    if (extended)
+    {
+        key = *(uint32_t *)p_addr ^ *(uint32_t *)(p_addr + sizeof(uint32_t));
+    }
+    else
+    {
+        key = *(uint16_t *)p_addr;
+    }
+
+    return ((key * HASH_MULTIPLIER) >> 16) % num_of_slots_get(extended);
+}
+
+/**
+ * @brief Find an address in the neighbor table.
+ *
+ * The table uses open addressing with linear probing. A slot is empty if no data is set in it.
+ *
+ * @param[in]  p_addr           Pointer to an address that is searched for.
+ * @param[out] p_location       If the address @p p_addr appears in the table, this is its index in the table.
+ *                              Otherwise, it is the index at which @p p_addr is to be added.
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ *
+ * @retval true   Address @p p_addr is in the table.
+ * @retval false  Address @p p_addr is not in the table.
+ */
+static bool addr_index_find(const uint8_t * p_addr, uint32_t * p_location, bool extended)
+{
+    uint32_t location = addr_hash(p_addr, extended);
+
+    // The load factor never exceeds 50%, so an empty slot terminates the search.
+    while (neighbor_data_get(location, extended)->flags != 0)
+    {
+        if (addr_compare(p_addr, neighbor_addr_get(location, extended), extended) == 0)
+        {
+            *p_location = location;
+            return true;
+        }
+
+        location = slot_next_get(location, extended);
+    }
+
+    *p_location = location;
+    return false;
+}
+
+/**
+ * @brief Add an address to the neighbor table.
+ *
+ * @param[in]  p_addr           Pointer to the address to be added.
+ * @param[in]  location         Index of the empty slot found by @ref addr_index_find.
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ *
+ * @retval true   Address @p p_addr has been added to the table successfully.
+ * @retval false  Address @p p_addr could not be added to the table.
+ */
+static bool addr_add(const uint8_t * p_addr, uint32_t location, bool extended)
+{
+    uint32_t * p_addr_array_len;
+    uint32_t   max_addr_array_len;
+
+    if (extended)
+    {
+        max_addr_array_len = NUM_EXTENDED_NEIGHBORS;
+        p_addr_array_len   = &m_neighbors.num_of_ext_addr;
+    }
+    else
+    {
+        max_addr_array_len = NUM_SHORT_NEIGHBORS;
+        p_addr_array_len   = &m_neighbors.num_of_short_addr;
+    }
+
+    if (*p_addr_array_len == max_addr_array_len)
+    {
+        return false;
+    }
+
+    memcpy(neighbor_addr_get(location, extended),
+           p_addr,
+           extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+
+    // The slot is considered occupied once the caller sets data in it.
+    neighbor_data_get(location, extended)->flags = 0;
+
+    (*p_addr_array_len)++;
+
+    return true;
+}
+
+/**
+ * @brief Remove an address from the neighbor table.
+ *
+ * Entries following the removed one in the same probe sequence are shifted back, so that no
+ * tombstones are needed.
+ *
+ * @param[in]  location     Index of the element to be removed from the table.
+ * @param[in]  extended     Indication if address to remove is an extended or a short address.
+ *
+ * @retval true   Address has been removed from the table successfully.
+ * @retval false  Address could not removed from the table.
+ */
+static bool addr_remove(uint32_t location, bool extended)
+{
+    uint32_t * p_addr_array_len;
+    uint32_t   hole       = location;
+    uint32_t   next       = slot_next_get(location, extended);
+    uint8_t    entry_size = neighbor_entry_size_get(extended);
+
+    p_addr_array_len = extended ? &m_neighbors.num_of_ext_addr : &m_neighbors.num_of_short_addr;
+
+    if (*p_addr_array_len == 0)
+    {
+        return false;
+    }
+
+    neighbor_data_get(hole, extended)->flags = 0;
+
+    while (neighbor_data_get(next, extended)->flags != 0)
+    {
+        uint32_t home = addr_hash(neighbor_addr_get(next, extended), extended);
+
+        // Move the entry to the hole if the hole lies between its home slot and its current slot.
+        if (slot_distance_get(home, next, extended) >= slot_distance_get(hole, next, extended))
+        {
+            memcpy(neighbor_addr_get(hole, extended), neighbor_addr_get(next, extended), entry_size);
+            neighbor_data_get(next, extended)->flags = 0;
+            hole                                     = next;
+        }
+
+        next = slot_next_get(next, extended);
+    }
+
+    (*p_addr_array_len)--;
+
+    return true;
+}
+
+/**
+ * @brief Clear a given type of ACK data for all addresses in the neighbor table.
+ *
+ * Entries left without any data are removed from the table.
+ *
+ * @param[in]  data_type    Type of data to be cleared.
+ * @param[in]  extended     Indication if extended or short addresses are to be processed.
+ */
+static void addr_data_type_clear(uint8_t data_type, bool extended)
+{
+    uint32_t location = 0;
+
+    while (location < num_of_slots_get(extended))
+    {
+        neighbor_data_t * p_neighbor = neighbor_data_get(location, extended);
+
+        if (p_neighbor->flags & data_flag_get(data_type))
+        {
+            p_neighbor->flags &= ~data_flag_get(data_type);
+
+            if (p_neighbor->flags == 0)
+            {
+                // Removal may shift a not yet processed entry to this slot. Check it again.
+                (void)addr_remove(location, extended);
+                continue;
+            }
+        }
+
+        location++;
+    }
+}
+
+/**
+ * @brief Set a given type of ACK data for multiple addresses.
+ *
+ * Either all addresses are added, or the table is left unmodified.
+ *
+ * @param[in]  p_addrs      Pointer to the sorted array of addresses.
+ * @param[in]  num_addrs    Number of addresses in @p p_addrs.
+ * @param[in]  data_type    Type of data to be set.
+ * @param[in]  extended     Indication if @p p_addrs contains extended or short addresses.
+ * @param[in]  p_data       Pointer to the IE data to be set for every address.
+ * @param[in]  data_len     Length of @p p_data.
+ *
+ * @retval true   Data has been set for all addresses.
+ * @retval false  There is not enough space to set data for all addresses.
+ */
+static bool addr_batch_add(const uint8_t * p_addrs,
+                           uint32_t        num_addrs,
+                           uint8_t         data_type,
+                           bool            extended,
+                           const uint8_t * p_data,
+                           uint8_t         data_len)
+{
+    uint8_t    addr_size       = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    uint8_t    flag            = data_flag_get(data_type);
+    uint32_t   max_num_of_data = extended ? NUM_EXTENDED_ADDRESSES : NUM_SHORT_ADDRESSES;
+    uint32_t   max_num_of_addr = extended ? NUM_EXTENDED_NEIGHBORS : NUM_SHORT_NEIGHBORS;
+    uint32_t * p_num_of_data   = num_of_data_get(data_type, extended);
+    uint32_t * p_addr_array_len;
+    uint32_t   num_new     = 0;
+    uint32_t   num_flagged = 0;
+    uint32_t   location;
+
+    p_addr_array_len = extended ? &m_neighbors.num_of_ext_addr : &m_neighbors.num_of_short_addr;
+
+    for (uint32_t i = 0; i < num_addrs; i++)
+    {
+        if (addr_is_duplicate(p_addrs, i, extended))
+        {
+            continue;
+        }
+
+        if (!addr_index_find(p_addrs + addr_size * i, &location, extended))
+        {
+            num_new++;
+            num_flagged++;
+        }
+        else if (!(neighbor_data_get(location, extended)->flags & flag))
+        {
+            num_flagged++;
+        }
+    }
+
+    if ((*p_addr_array_len + num_new > max_num_of_addr) ||
+        (*p_num_of_data + num_flagged > max_num_of_data))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < num_addrs; i++)
+    {
+        const uint8_t * p_addr = p_addrs + addr_size * i;
+
+        if (addr_is_duplicate(p_addrs, i, extended))
+        {
+            continue;
+        }
+
+        if (!addr_index_find(p_addr, &location, extended))
+        {
+            (void)addr_add(p_addr, location, extended);
+        }
+
+        neighbor_data_get(location, extended)->flags |= flag;
+
+        if (data_type == NRF_802154_ACK_DATA_IE)
+        {
+            ie_data_add(location, extended, p_data, data_len);
+        }
+    }
+
+    *p_num_of_data += num_flagged;
+
+    return true;
+}
+
+/**
+ * @brief Clear a given type of ACK data for multiple addresses.
+ *
+ * @param[in]  p_addrs      Pointer to the sorted array of addresses.
+ * @param[in]  num_addrs    Number of addresses in @p p_addrs.
+ * @param[in]  data_type    Type of data to be cleared.
+ * @param[in]  extended     Indication if @p p_addrs contains extended or short addresses.
+ *
+ * @retval true   Data has been cleared for all addresses.
+ * @retval false  Data was not set for at least one of the addresses.
+ */
+static bool addr_batch_remove(const uint8_t * p_addrs,
+                              uint32_t        num_addrs,
+                              uint8_t         data_type,
+                              bool            extended)
+{
+    uint8_t  addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    uint8_t  flag      = data_flag_get(data_type);
+    bool     all_found = true;
+    uint32_t location;
+
+    for (uint32_t i = 0; i < num_addrs; i++)
+    {
+        neighbor_data_t * p_neighbor;
+
+        if (addr_is_duplicate(p_addrs, i, extended))
+        {
+            continue;
+        }
+
+        if (!addr_index_find(p_addrs + addr_size * i, &location, extended))
+        {
+            all_found = false;
+            continue;
+        }
+
+        p_neighbor = neighbor_data_get(location, extended);
+
+        if (!(p_neighbor->flags & flag))
+        {
+            all_found = false;
+            continue;
+        }
+
+        p_neighbor->flags &= ~flag;
+        (*num_of_data_get(data_type, extended))--;
+
+        if (p_neighbor->flags == 0)
+        {
+            (void)addr_remove(location, extended);
+        }
+    }
+
+    return all_found;
+}
+
+#else // NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+
+/***************************************************************************************************
+ * @section Sorted array storage
+ **************************************************************************************************/
+
+/**
+ * @brief Perform a binary search for an address in the neighbor table.
  *
  * @param[in]  p_addr           Pointer to an address that is searched for.
- * @param[in]  p_addr_array     Pointer to a list of addresses to be searched.
  * @param[out] p_location       If the address @p p_addr appears in the list, this is its index in the address list.
  *                              Otherwise, it is the index which @p p_addr would have if it was placed in the list
  *                              (ascending order assumed).
@@ -200,31 +726,13 @@ static int8_t addr_compare(const uint8_t * p_first_addr,
  * @retval false  Address @p p_addr is not in the list.
  */
 static bool addr_binary_search(const uint8_t * p_addr,
-                               const uint8_t * p_addr_array,
                                uint32_t      * p_location,
-                               uint8_t         data_type,
                                bool            extended)
 {
-    uint32_t addr_array_len = 0;
-    uint8_t  entry_size     = 0;
-
-    switch (data_type)
-    {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            entry_size     = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
-            addr_array_len = extended ?
-                             m_pending_bit.num_of_ext_addr : m_pending_bit.num_of_short_addr;
-            break;
-
-        case NRF_802154_ACK_DATA_IE:
-            entry_size     = extended ? sizeof(ack_ext_ie_data_t) : sizeof(ack_short_ie_data_t);
-            addr_array_len = extended ? m_ie.num_of_ext_data : m_ie.num_of_short_data;
-            break;
-
-        default:
-            assert(false);
-            break;
-    }
+    const uint8_t * p_addr_array   = neighbor_array_get(extended);
+    uint32_t        addr_array_len =
+        extended ? m_neighbors.num_of_ext_addr : m_neighbors.num_of_short_addr;
+    uint8_t entry_size = neighbor_entry_size_get(extended);
 
     // The actual algorithm
     int32_t  low      = 0;
@@ -246,122 +754,474 @@ static bool addr_binary_search(const uint8_t * p_addr,
                 high = (int32_t)(midpoint - 1);
                 break;
 
-            case 0:
-                *p_location = midpoint;
-                return true;
+            case 0:
+                *p_location = midpoint;
+                return true;
+
+            case 1:
+                low = (int32_t)(midpoint + 1);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    /* If in the last iteration of the loop the last case was utilized, it means that the midpoint
+     * found by the algorithm is less than the address to be added. The midpoint should be therefore
+     * shifted to the next position. As a simplified example, a { 1, 3, 4 } array can be considered.
+     * Suppose that a number equal to 2 is about to be added to the array. At the beginning of the
+     * last iteration, midpoint is equal to 1 and low and high are equal to 0. Midpoint is then set
+     * to 0 and with last case being utilized, low is set to 1. However, midpoint equal to 0 is
+     * incorrect, as in the last iteration first element of the array proves to be less than the
+     * element to be added to the array. With the below code, midpoint is then shifted to 1. */
+    if ((uint32_t)low == midpoint + 1)
+    {
+        midpoint++;
+    }
+
+    *p_location = midpoint;
+    return false;
+}
+
+/**
+ * @brief Find an address in the neighbor table.
+ *
+ * @param[in]  p_addr           Pointer to an address that is searched for.
+ * @param[out] p_location       If the address @p p_addr appears in the table, this is its index in the table.
+ *                              Otherwise, it is the index at which @p p_addr is to be added.
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ *
+ * @retval true   Address @p p_addr is in the table.
+ * @retval false  Address @p p_addr is not in the table.
+ */
+static inline bool addr_index_find(const uint8_t * p_addr, uint32_t * p_location, bool extended)
+{
+    return addr_binary_search(p_addr, p_location, extended);
+}
+
+/**
+ * @brief Add an address to the neighbor table in ascending order.
+ *
+ * @param[in]  p_addr           Pointer to the address to be added.
+ * @param[in]  location         Index of the location where @p p_addr should be added.
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ *
+ * @retval true   Address @p p_addr has been added to the list successfully.
+ * @retval false  Address @p p_addr could not be added to the list.
+ */
+static bool addr_add(const uint8_t * p_addr, uint32_t location, bool extended)
+{
+    uint32_t * p_addr_array_len;
+    uint32_t   max_addr_array_len;
+    uint8_t  * p_addr_array = neighbor_array_get(extended);
+    uint8_t    entry_size   = neighbor_entry_size_get(extended);
+
+    if (extended)
+    {
+        max_addr_array_len = NUM_EXTENDED_NEIGHBORS;
+        p_addr_array_len   = &m_neighbors.num_of_ext_addr;
+    }
+    else
+    {
+        max_addr_array_len = NUM_SHORT_NEIGHBORS;
+        p_addr_array_len   = &m_neighbors.num_of_short_addr;
+    }
+
+    if (*p_addr_array_len == max_addr_array_len)
+    {
+        return false;
+    }
+
+    memmove(p_addr_array + entry_size * (location + 1),
+            p_addr_array + entry_size * (location),
+            (*p_addr_array_len - location) * entry_size);
+
+    memcpy(p_addr_array + entry_size * location,
+           p_addr,
+           extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+
+    neighbor_data_get(location, extended)->flags = 0;
+
+    (*p_addr_array_len)++;
+
+    return true;
+}
+
+/**
+ * @brief Remove an address from the neighbor table keeping it in ascending order.
+ *
+ * @param[in]  location     Index of the element to be removed from the list.
+ * @param[in]  extended     Indication if address to remove is an extended or a short address.
+ *
+ * @retval true   Address @p p_addr has been removed from the list successfully.
+ * @retval false  Address @p p_addr could not removed from the list.
+ */
+static bool addr_remove(uint32_t location, bool extended)
+{
+    uint32_t * p_addr_array_len;
+    uint8_t  * p_addr_array = neighbor_array_get(extended);
+    uint8_t    entry_size   = neighbor_entry_size_get(extended);
+
+    p_addr_array_len = extended ? &m_neighbors.num_of_ext_addr : &m_neighbors.num_of_short_addr;
+
+    if (*p_addr_array_len == 0)
+    {
+        return false;
+    }
+
+    memmove(p_addr_array + entry_size * location,
+            p_addr_array + entry_size * (location + 1),
+            (*p_addr_array_len - location - 1) * entry_size);
+
+    (*p_addr_array_len)--;
+
+    return true;
+}
+
+/**
+ * @brief Clear a given type of ACK data for all addresses in the neighbor table.
+ *
+ * Entries left without any data are removed and the table is compacted in a single pass.
+ *
+ * @param[in]  data_type    Type of data to be cleared.
+ * @param[in]  extended     Indication if extended or short addresses are to be processed.
+ */
+static void addr_data_type_clear(uint8_t data_type, bool extended)
+{
+    uint8_t  * p_addr_array = neighbor_array_get(extended);
+    uint8_t    entry_size   = neighbor_entry_size_get(extended);
+    uint32_t * p_addr_array_len;
+    uint32_t   kept = 0;
+
+    p_addr_array_len = extended ? &m_neighbors.num_of_ext_addr : &m_neighbors.num_of_short_addr;
+
+    for (uint32_t i = 0; i < *p_addr_array_len; i++)
+    {
+        neighbor_data_t * p_neighbor = neighbor_data_get(i, extended);
+
+        p_neighbor->flags &= ~data_flag_get(data_type);
+
+        if (p_neighbor->flags != 0)
+        {
+            if (kept != i)
+            {
+                memcpy(p_addr_array + entry_size * kept, p_addr_array + entry_size * i, entry_size);
+            }
+
+            kept++;
+        }
+    }
+
+    *p_addr_array_len = kept;
+}
+
+/**
+ * @brief Set a given type of ACK data for multiple addresses.
+ *
+ * The sorted addresses are merged into the sorted neighbor table in a single pass, starting from
+ * the end of the table, so that every entry is moved at most once.
+ * Either all addresses are added, or the table is left unmodified.
+ *
+ * @param[in]  p_addrs      Pointer to the sorted array of addresses.
+ * @param[in]  num_addrs    Number of addresses in @p p_addrs.
+ * @param[in]  data_type    Type of data to be set.
+ * @param[in]  extended     Indication if @p p_addrs contains extended or short addresses.
+ * @param[in]  p_data       Pointer to the IE data to be set for every address.
+ * @param[in]  data_len     Length of @p p_data.
+ *
+ * @retval true   Data has been set for all addresses.
+ * @retval false  There is not enough space to set data for all addresses.
+ */
+static bool addr_batch_add(const uint8_t * p_addrs,
+                           uint32_t        num_addrs,
+                           uint8_t         data_type,
+                           bool            extended,
+                           const uint8_t * p_data,
+                           uint8_t         data_len)
+{
+    uint8_t    addr_size       = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    uint8_t    entry_size      = neighbor_entry_size_get(extended);
+    uint8_t    flag            = data_flag_get(data_type);
+    uint32_t   max_num_of_data = extended ? NUM_EXTENDED_ADDRESSES : NUM_SHORT_ADDRESSES;
+    uint32_t   max_num_of_addr = extended ? NUM_EXTENDED_NEIGHBORS : NUM_SHORT_NEIGHBORS;
+    uint32_t * p_num_of_data   = num_of_data_get(data_type, extended);
+    uint32_t * p_addr_array_len;
+    uint32_t   num_new     = 0;
+    uint32_t   num_flagged = 0;
+    uint32_t   entry       = 0;
+    uint32_t   addr        = 0;
+    int32_t    src;
+    int32_t    dst;
+    int32_t    in;
+
+    p_addr_array_len = extended ? &m_neighbors.num_of_ext_addr : &m_neighbors.num_of_short_addr;
+
+    // Count the addresses to add to check if all of them fit.
+    while (addr < num_addrs)
+    {
+        int8_t compare_result;
+
+        if (addr_is_duplicate(p_addrs, addr, extended))
+        {
+            addr++;
+            continue;
+        }
+
+        compare_result = (entry < *p_addr_array_len) ?
+                         addr_compare(neighbor_addr_get(entry, extended),
+                                      p_addrs + addr_size * addr,
+                                      extended) : 1;
+
+        if (compare_result < 0)
+        {
+            entry++;
+        }
+        else if (compare_result == 0)
+        {
+            if (!(neighbor_data_get(entry, extended)->flags & flag))
+            {
+                num_flagged++;
+            }
+
+            entry++;
+            addr++;
+        }
+        else
+        {
+            num_new++;
+            num_flagged++;
+            addr++;
+        }
+    }
+
+    if ((*p_addr_array_len + num_new > max_num_of_addr) ||
+        (*p_num_of_data + num_flagged > max_num_of_data))
+    {
+        return false;
+    }
+
+    // Merge from the end, so that no entry is overwritten before it is moved.
+    src = (int32_t)*p_addr_array_len - 1;
+    dst = (int32_t)(*p_addr_array_len + num_new) - 1;
+    in  = (int32_t)num_addrs - 1;
+
+    while (in >= 0)
+    {
+        const uint8_t * p_addr = p_addrs + addr_size * in;
+        int8_t          compare_result;
+
+        if (addr_is_duplicate(p_addrs, in, extended))
+        {
+            in--;
+            continue;
+        }
+
+        compare_result = (src >= 0) ?
+                         addr_compare(neighbor_addr_get(src, extended), p_addr, extended) : -1;
+
+        if (compare_result >= 0)
+        {
+            if (src != dst)
+            {
+                memcpy(neighbor_addr_get(dst, extended), neighbor_addr_get(src, extended), entry_size);
+            }
+
+            src--;
+        }
+
+        if (compare_result <= 0)
+        {
+            if (compare_result < 0)
+            {
+                memcpy(neighbor_addr_get(dst, extended), p_addr, addr_size);
+                neighbor_data_get(dst, extended)->flags = 0;
+            }
+
+            neighbor_data_get(dst, extended)->flags |= flag;
+
+            if (data_type == NRF_802154_ACK_DATA_IE)
+            {
+                ie_data_add(dst, extended, p_data, data_len);
+            }
+
+            in--;
+        }
+
+        dst--;
+    }
+
+    // Entries preceding all added addresses are already in place.
+    *p_addr_array_len += num_new;
+    *p_num_of_data    += num_flagged;
+
+    return true;
+}
+
+/**
+ * @brief Clear a given type of ACK data for multiple addresses.
+ *
+ * The sorted addresses are matched against the sorted neighbor table and the table is compacted
+ * in a single pass.
+ *
+ * @param[in]  p_addrs      Pointer to the sorted array of addresses.
+ * @param[in]  num_addrs    Number of addresses in @p p_addrs.
+ * @param[in]  data_type    Type of data to be cleared.
+ * @param[in]  extended     Indication if @p p_addrs contains extended or short addresses.
+ *
+ * @retval true   Data has been cleared for all addresses.
+ * @retval false  Data was not set for at least one of the addresses.
+ */
+static bool addr_batch_remove(const uint8_t * p_addrs,
+                              uint32_t        num_addrs,
+                              uint8_t         data_type,
+                              bool            extended)
+{
+    uint8_t    addr_size  = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    uint8_t    entry_size = neighbor_entry_size_get(extended);
+    uint8_t    flag       = data_flag_get(data_type);
+    uint32_t * p_addr_array_len;
+    uint32_t   kept      = 0;
+    uint32_t   addr      = 0;
+    bool       all_found = true;
+
+    p_addr_array_len = extended ? &m_neighbors.num_of_ext_addr : &m_neighbors.num_of_short_addr;
+
+    for (uint32_t entry = 0; entry < *p_addr_array_len; entry++)
+    {
+        neighbor_data_t * p_neighbor = neighbor_data_get(entry, extended);
+        const uint8_t   * p_entry    = neighbor_addr_get(entry, extended);
+
+        // Skip addresses that are not in the table.
+        while ((addr < num_addrs) &&
+               (addr_compare(p_addrs + addr_size * addr, p_entry, extended) < 0))
+        {
+            all_found &= addr_is_duplicate(p_addrs, addr, extended);
+            addr++;
+        }
+
+        if ((addr < num_addrs) && (addr_compare(p_addrs + addr_size * addr, p_entry, extended) == 0))
+        {
+            if (p_neighbor->flags & flag)
+            {
+                p_neighbor->flags &= ~flag;
+                (*num_of_data_get(data_type, extended))--;
+            }
+            else
+            {
+                all_found = false;
+            }
+
+            do
+            {
+                addr++;
+            }
+            while ((addr < num_addrs) && addr_is_duplicate(p_addrs, addr, extended));
+        }
 
-            case 1:
-                low = (int32_t)(midpoint + 1);
-                break;
+        if (p_neighbor->flags != 0)
+        {
+            if (kept != entry)
+            {
+                memcpy(neighbor_addr_get(kept, extended), p_entry, entry_size);
+            }
 
-            default:
-                break;
+            kept++;
         }
     }
 
-    /* If in the last iteration of the loop the last case was utilized, it means that the midpoint
-     * found by the algorithm is less than the address to be added. The midpoint should be therefore
-     * shifted to the next position. As a simplified example, a { 1, 3, 4 } array can be considered.
-     * Suppose that a number equal to 2 is about to be added to the array. At the beginning of the
-     * last iteration, midpoint is equal to 1 and low and high are equal to 0. Midpoint is then set
-     * to 0 and with last case being utilized, low is set to 1. However, midpoint equal to 0 is
-     * incorrect, as in the last iteration first element of the array proves to be less than the
-     * element to be added to the array. With the below code, midpoint is then shifted to 1. */
-    if ((uint32_t)low == midpoint + 1)
+    if (addr < num_addrs)
     {
-        midpoint++;
+        all_found = false;
     }
 
-    *p_location = midpoint;
-    return false;
+    *p_addr_array_len = kept;
+
+    return all_found;
 }
 
+#endif // NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+
+/***************************************************************************************************
+ * @section Source address matching
+ **************************************************************************************************/
+
 /**
- * @brief Find an address in a list of addresses.
+ * @brief Find ACK data stored for a given address.
  *
- * @param[in]  p_addr           Pointer to an address that is searched for.
- * @param[out] p_location       If the address @p p_addr appears in the list, this is its index in the address list.
- *                              Otherwise, it is the index which @p p_addr would have if it was placed in the list
- *                              (ascending order assumed).
- * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ * @param[in]  p_addr    Pointer to an address that is searched for. May be NULL.
+ * @param[in]  extended  Indication if @p p_addr is an extended or a short addresses.
  *
- * @retval true   Address @p p_addr is in the list.
- * @retval false  Address @p p_addr is not in the list.
+ * @returns  Pointer to ACK data of the node or NULL if there is no data for @p p_addr.
  */
-static bool addr_index_find(const uint8_t * p_addr,
-                            uint32_t      * p_location,
-                            uint8_t         data_type,
-                            bool            extended)
+static const neighbor_data_t * neighbor_find(const uint8_t * p_addr, bool extended)
 {
-    uint8_t * p_addr_array;
-    bool      valid_data_type = true;
+    uint32_t location;
 
-    switch (data_type)
+    if ((NULL == p_addr) || !addr_index_find(p_addr, &location, extended))
     {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            p_addr_array = extended ? (uint8_t *)m_pending_bit.extended_addr :
-                           (uint8_t *)m_pending_bit.short_addr;
-            break;
-
-        case NRF_802154_ACK_DATA_IE:
-            p_addr_array = extended ? (uint8_t *)m_ie.ext_data : (uint8_t *)m_ie.short_data;
-            break;
-
-        default:
-            valid_data_type = false;
-            assert(false);
-            break;
+        return NULL;
     }
 
-    if (!valid_data_type)
-    {
-        return false;
-    }
+    return neighbor_data_get(location, extended);
+}
 
-    return addr_binary_search(p_addr, p_addr_array, p_location, data_type, extended);
+/**
+ * @brief Check if a given type of ACK data is set for the neighbor.
+ *
+ * @param[in]  p_neighbor  Pointer to ACK data of the neighbor. May be NULL.
+ * @param[in]  data_type   Type of ACK data.
+ *
+ * @retval true   @p data_type is set for the neighbor.
+ * @retval false  @p data_type is not set for the neighbor.
+ */
+static inline bool neighbor_has_data(const neighbor_data_t * p_neighbor, uint8_t data_type)
+{
+    return (NULL != p_neighbor) && (p_neighbor->flags & data_flag_get(data_type));
 }
 
 /**
  * @brief Thread implementation of the address matching algorithm.
  *
- * @param[in]  p_frame  Pointer to the frame for which the ACK frame is being prepared.
+ * @param[in]  p_src_addr  Pointer to the source address of the frame. May be NULL.
+ * @param[in]  p_neighbor  Pointer to ACK data stored for @p p_src_addr or NULL if there is none.
  *
  * @retval true   Pending bit is to be set.
  * @retval false  Pending bit is to be cleared.
  */
-static bool addr_match_thread(const uint8_t * p_frame)
+static bool addr_match_thread(const uint8_t * p_src_addr, const neighbor_data_t * p_neighbor)
 {
-    bool            extended;
-    uint32_t        location;
-    const uint8_t * p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame, &extended);
-
     // The pending bit is set by default.
-    if (!m_pending_bit.enabled || (NULL == p_src_addr))
+    if (!m_neighbors.enabled || (NULL == p_src_addr))
     {
         return true;
     }
 
-    return addr_index_find(p_src_addr, &location, NRF_802154_ACK_DATA_PENDING_BIT, extended);
+    return neighbor_has_data(p_neighbor, NRF_802154_ACK_DATA_PENDING_BIT);
 }
 
 /**
  * @brief Zigbee implementation of the address matching algorithm.
  *
- * @param[in]  p_frame  Pointer to the frame for which the ACK frame is being prepared.
+ * @param[in]  p_frame       Pointer to the frame for which the ACK frame is being prepared.
+ * @param[in]  p_mhr_fields  Pointer to the parsed MAC header of @p p_frame or NULL if the
+ *                           header is invalid.
+ * @param[in]  p_neighbor    Pointer to ACK data stored for the source address of @p p_frame
+ *                           or NULL if there is none.
  *
  * @retval true   Pending bit is to be set.
  * @retval false  Pending bit is to be cleared.
  */
-static bool addr_match_zigbee(const uint8_t * p_frame)
+static bool addr_match_zigbee(const uint8_t                            * p_frame,
+                              const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields,
+                              const neighbor_data_t                    * p_neighbor)
 {
-    uint8_t                            frame_type;
-    nrf_802154_frame_parser_mhr_data_t mhr_fields;
-    uint32_t                           location;
-    const uint8_t                    * p_cmd = p_frame;
-    bool                               ret   = false;
+    uint8_t         frame_type;
+    const uint8_t * p_cmd = p_frame;
+    bool            ret   = false;
 
     // If ack data generator module is disabled do not perform check, return true by default.
-    if (!m_pending_bit.enabled)
+    if (!m_neighbors.enabled)
     {
         return true;
     }
@@ -369,13 +1229,13 @@ static bool addr_match_zigbee(const uint8_t * p_frame)
     // Check the frame type.
     frame_type = (p_frame[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK);
 
-    // Parse the MAC header and retrieve the command type.
-    if (nrf_802154_frame_parser_mhr_parse(p_frame, &mhr_fields))
+    // Retrieve the command type.
+    if (NULL != p_mhr_fields)
     {
         // Note: Security header is not included in the offset.
         // If security is to be used at any point, additional calculation
         // in nrf_802154_frame_parser_mhr_parse needs to be implemented.
-        p_cmd += mhr_fields.addressing_end_offset;
+        p_cmd += p_mhr_fields->addressing_end_offset;
     }
     else
     {
@@ -388,13 +1248,10 @@ static bool addr_match_zigbee(const uint8_t * p_frame)
     if ((frame_type == FRAME_TYPE_COMMAND) && (*p_cmd == MAC_CMD_DATA_REQ))
     {
         // Check addressing type - in long case address, pb should always be 1.
-        if (mhr_fields.src_addr_size == SHORT_ADDRESS_SIZE)
+        if (p_mhr_fields->src_addr_size == SHORT_ADDRESS_SIZE)
         {
-            // Return true if address is not found on the m_pending_bits list.
-            ret = !addr_index_find(mhr_fields.p_src_addr,
-                                   &location,
-                                   NRF_802154_ACK_DATA_PENDING_BIT,
-                                   false);
+            // Return true if address is not found on the pending bit list.
+            ret = !neighbor_has_data(p_neighbor, NRF_802154_ACK_DATA_PENDING_BIT);
         }
         else
         {
@@ -422,163 +1279,43 @@ static bool addr_match_standard_compliant(const uint8_t * p_frame)
 }
 
 /**
- * @brief Add an address to the address list in ascending order.
+ * @brief Compute the pending bit for a frame using the selected source matching method.
  *
- * @param[in]  p_addr           Pointer to the address to be added.
- * @param[in]  location         Index of the location where @p p_addr should be added.
- * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ * @param[in]  p_frame       Pointer to the frame for which the ACK frame is being prepared.
+ * @param[in]  p_mhr_fields  Pointer to the parsed MAC header of @p p_frame or NULL if the
+ *                           header is invalid.
+ * @param[in]  p_neighbor    Pointer to ACK data stored for the source address of @p p_frame
+ *                           or NULL if there is none.
  *
- * @retval true   Address @p p_addr has been added to the list successfully.
- * @retval false  Address @p p_addr could not be added to the list.
+ * @retval true   Pending bit is to be set.
+ * @retval false  Pending bit is to be cleared.
  */
-static bool addr_add(const uint8_t * p_addr, uint32_t location, uint8_t data_type, bool extended)
+static bool pending_bit_get(const uint8_t                            * p_frame,
+                            const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields,
+                            const neighbor_data_t                    * p_neighbor)
 {
-    uint32_t * p_addr_array_len;
-    uint32_t   max_addr_array_len;
-    uint8_t  * p_addr_array;
-    uint8_t    entry_size;
-    bool       valid_data_type = true;
+    bool ret = true;
 
-    switch (data_type)
+    switch (m_src_matching_method)
     {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
-            {
-                p_addr_array       = (uint8_t *)m_pending_bit.extended_addr;
-                max_addr_array_len = NUM_EXTENDED_ADDRESSES;
-                p_addr_array_len   = &m_pending_bit.num_of_ext_addr;
-                entry_size         = EXTENDED_ADDRESS_SIZE;
-            }
-            else
-            {
-                p_addr_array       = (uint8_t *)m_pending_bit.short_addr;
-                max_addr_array_len = NUM_SHORT_ADDRESSES;
-                p_addr_array_len   = &m_pending_bit.num_of_short_addr;
-                entry_size         = SHORT_ADDRESS_SIZE;
-            }
-            break;
-
-        case NRF_802154_ACK_DATA_IE:
-            if (extended)
-            {
-                p_addr_array       = (uint8_t *)m_ie.ext_data;
-                max_addr_array_len = NUM_EXTENDED_ADDRESSES;
-                p_addr_array_len   = &m_ie.num_of_ext_data;
-                entry_size         = sizeof(ack_ext_ie_data_t);
-            }
-            else
-            {
-                p_addr_array       = (uint8_t *)m_ie.short_data;
-                max_addr_array_len = NUM_SHORT_ADDRESSES;
-                p_addr_array_len   = &m_ie.num_of_short_data;
-                entry_size         = sizeof(ack_short_ie_data_t);
-            }
-            break;
-
-        default:
-            valid_data_type = false;
-            assert(false);
+        case NRF_802154_SRC_ADDR_MATCH_THREAD:
+            ret = addr_match_thread(p_mhr_fields == NULL ? NULL : p_mhr_fields->p_src_addr,
+                                    p_neighbor);
             break;
-    }
-
-    if (!valid_data_type || (*p_addr_array_len == max_addr_array_len))
-    {
-        return false;
-    }
-
-    memmove(p_addr_array + entry_size * (location + 1),
-            p_addr_array + entry_size * (location),
-            (*p_addr_array_len - location) * entry_size);
-
-    memcpy(p_addr_array + entry_size * location,
-           p_addr,
-           extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
-
-    (*p_addr_array_len)++;
-
-    return true;
-}
-
-/**
- * @brief Remove an address from the address list keeping it in ascending order.
- *
- * @param[in]  location     Index of the element to be removed from the list.
- * @param[in]  extended     Indication if address to remove is an extended or a short address.
- *
- * @retval true   Address @p p_addr has been removed from the list successfully.
- * @retval false  Address @p p_addr could not removed from the list.
- */
-static bool addr_remove(uint32_t location, uint8_t data_type, bool extended)
-{
-    uint32_t * p_addr_array_len;
-    uint8_t  * p_addr_array;
-    uint8_t    entry_size;
-    bool       valid_data_type = true;
 
-    switch (data_type)
-    {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
-            {
-                p_addr_array     = (uint8_t *)m_pending_bit.extended_addr;
-                p_addr_array_len = &m_pending_bit.num_of_ext_addr;
-                entry_size       = EXTENDED_ADDRESS_SIZE;
-            }
-            else
-            {
-                p_addr_array     = (uint8_t *)m_pending_bit.short_addr;
-                p_addr_array_len = &m_pending_bit.num_of_short_addr;
-                entry_size       = SHORT_ADDRESS_SIZE;
-            }
+        case NRF_802154_SRC_ADDR_MATCH_ZIGBEE:
+            ret = addr_match_zigbee(p_frame, p_mhr_fields, p_neighbor);
             break;
 
-        case NRF_802154_ACK_DATA_IE:
-            if (extended)
-            {
-                p_addr_array     = (uint8_t *)m_ie.ext_data;
-                p_addr_array_len = &m_ie.num_of_ext_data;
-                entry_size       = sizeof(ack_ext_ie_data_t);
-            }
-            else
-            {
-                p_addr_array     = (uint8_t *)m_ie.short_data;
-                p_addr_array_len = &m_ie.num_of_short_data;
-                entry_size       = sizeof(ack_short_ie_data_t);
-            }
+        case NRF_802154_SRC_ADDR_MATCH_ALWAYS_1:
+            ret = addr_match_standard_compliant(p_frame);
             break;
 
         default:
-            valid_data_type = false;
             assert(false);
-            break;
-    }
-
-    if (!valid_data_type || (*p_addr_array_len == 0))
-    {
-        return false;
     }
 
-    memmove(p_addr_array + entry_size * location,
-            p_addr_array + entry_size * (location + 1),
-            (*p_addr_array_len - location - 1) * entry_size);
-
-    (*p_addr_array_len)--;
-
-    return true;
-}
-
-static void ie_data_add(uint32_t location, bool extended, const uint8_t * p_data, uint8_t data_len)
-{
-    if (extended)
-    {
-        memcpy(m_ie.ext_data[location].ie_data.p_data, p_data, data_len);
-        m_ie.ext_data[location].ie_data.len = data_len;
-    }
-    else
-    {
-        memcpy(m_ie.short_data[location].ie_data.p_data, p_data, data_len);
-        m_ie.short_data[location].ie_data.len = data_len;
-    }
+    return ret;
 }
 
 /***************************************************************************************************
@@ -587,16 +1324,15 @@ static void ie_data_add(uint32_t location, bool extended, const uint8_t * p_data
 
 void nrf_802154_ack_data_init(void)
 {
-    memset(&m_pending_bit, 0, sizeof(m_pending_bit));
-    memset(&m_ie, 0, sizeof(m_ie));
+    memset(&m_neighbors, 0, sizeof(m_neighbors));
 
-    m_pending_bit.enabled = true;
+    m_neighbors.enabled   = true;
     m_src_matching_method = NRF_802154_SRC_ADDR_MATCH_THREAD;
 }
 
 void nrf_802154_ack_data_enable(bool enabled)
 {
-    m_pending_bit.enabled = enabled;
+    m_neighbors.enabled = enabled;
 }
 
 bool nrf_802154_ack_data_for_addr_set(const uint8_t * p_addr,
@@ -605,67 +1341,134 @@ bool nrf_802154_ack_data_for_addr_set(const uint8_t * p_addr,
                                       const void    * p_data,
                                       uint8_t         data_len)
 {
-    uint32_t location = 0;
+    uint32_t          location = 0;
+    uint32_t        * p_num_of_data;
+    neighbor_data_t * p_neighbor;
+    uint32_t          max_num_of_data = extended ? NUM_EXTENDED_ADDRESSES : NUM_SHORT_ADDRESSES;
 
-    if (addr_index_find(p_addr, &location, data_type, extended) ||
-        addr_add(p_addr, location, data_type, extended))
+    if ((data_type != NRF_802154_ACK_DATA_PENDING_BIT) && (data_type != NRF_802154_ACK_DATA_IE))
     {
-        if (data_type == NRF_802154_ACK_DATA_IE)
-        {
-            ie_data_add(location, extended, p_data, data_len);
-        }
+        assert(false);
+        return false;
+    }
 
-        return true;
+    p_num_of_data = num_of_data_get(data_type, extended);
+
+    if (addr_index_find(p_addr, &location, extended))
+    {
+        p_neighbor = neighbor_data_get(location, extended);
+    }
+    else if ((*p_num_of_data < max_num_of_data) && addr_add(p_addr, location, extended))
+    {
+        p_neighbor = neighbor_data_get(location, extended);
     }
     else
     {
         return false;
     }
+
+    if (!(p_neighbor->flags & data_flag_get(data_type)))
+    {
+        if (*p_num_of_data == max_num_of_data)
+        {
+            return false;
+        }
+
+        p_neighbor->flags |= data_flag_get(data_type);
+        (*p_num_of_data)++;
+    }
+
+    if (data_type == NRF_802154_ACK_DATA_IE)
+    {
+        ie_data_add(location, extended, p_data, data_len);
+    }
+
+    return true;
 }
 
 bool nrf_802154_ack_data_for_addr_clear(const uint8_t * p_addr, bool extended, uint8_t data_type)
 {
-    uint32_t location = 0;
+    uint32_t          location = 0;
+    neighbor_data_t * p_neighbor;
 
-    if (addr_index_find(p_addr, &location, data_type, extended))
+    if ((data_type != NRF_802154_ACK_DATA_PENDING_BIT) && (data_type != NRF_802154_ACK_DATA_IE))
     {
-        return addr_remove(location, data_type, extended);
+        assert(false);
+        return false;
     }
-    else
+
+    if (!addr_index_find(p_addr, &location, extended))
+    {
+        return false;
+    }
+
+    p_neighbor = neighbor_data_get(location, extended);
+
+    if (!(p_neighbor->flags & data_flag_get(data_type)))
     {
         return false;
     }
+
+    p_neighbor->flags &= ~data_flag_get(data_type);
+    (*num_of_data_get(data_type, extended))--;
+
+    if (p_neighbor->flags == 0)
+    {
+        return addr_remove(location, extended);
+    }
+
+    return true;
 }
 
 void nrf_802154_ack_data_reset(bool extended, uint8_t data_type)
 {
-    switch (data_type)
+    if ((data_type != NRF_802154_ACK_DATA_PENDING_BIT) && (data_type != NRF_802154_ACK_DATA_IE))
     {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
-            {
-                m_pending_bit.num_of_ext_addr = 0;
-            }
-            else
-            {
-                m_pending_bit.num_of_short_addr = 0;
-            }
-            break;
+        return;
+    }
 
-        case NRF_802154_ACK_DATA_IE:
-            if (extended)
-            {
-                m_ie.num_of_ext_data = 0;
-            }
-            else
-            {
-                m_ie.num_of_short_data = 0;
-            }
-            break;
+    addr_data_type_clear(data_type, extended);
+    *num_of_data_get(data_type, extended) = 0;
+}
 
-        default:
-            break;
+bool nrf_802154_ack_data_for_addr_set_batch(uint8_t       * p_addrs,
+                                            uint32_t        num_addrs,
+                                            bool            extended,
+                                            uint8_t         data_type,
+                                            const void    * p_data,
+                                            uint8_t         data_len)
+{
+    if ((data_type != NRF_802154_ACK_DATA_PENDING_BIT) && (data_type != NRF_802154_ACK_DATA_IE))
+    {
+        assert(false);
+        return false;
+    }
+
+    qsort(p_addrs,
+          num_addrs,
+          extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE,
+          extended ? extended_addr_sort_compare : short_addr_sort_compare);
+
+    return addr_batch_add(p_addrs, num_addrs, data_type, extended, p_data, data_len);
+}
+
+bool nrf_802154_ack_data_for_addr_clear_batch(uint8_t * p_addrs,
+                                              uint32_t  num_addrs,
+                                              bool      extended,
+                                              uint8_t   data_type)
+{
+    if ((data_type != NRF_802154_ACK_DATA_PENDING_BIT) && (data_type != NRF_802154_ACK_DATA_IE))
+    {
+        assert(false);
+        return false;
     }
+
+    qsort(p_addrs,
+          num_addrs,
+          extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE,
+          extended ? extended_addr_sort_compare : short_addr_sort_compare);
+
+    return addr_batch_remove(p_addrs, num_addrs, data_type, extended);
 }
 
 void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_t match_method)
@@ -686,16 +1489,31 @@ void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_
 
 bool nrf_802154_ack_data_pending_bit_should_be_set(const uint8_t * p_frame)
 {
-    bool ret;
+    bool                               ret = true;
+    bool                               extended;
+    const uint8_t                    * p_src_addr;
+    nrf_802154_frame_parser_mhr_data_t mhr_fields;
 
     switch (m_src_matching_method)
     {
         case NRF_802154_SRC_ADDR_MATCH_THREAD:
-            ret = addr_match_thread(p_frame);
+            p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame, &extended);
+            ret        = addr_match_thread(p_src_addr, neighbor_find(p_src_addr, extended));
             break;
 
         case NRF_802154_SRC_ADDR_MATCH_ZIGBEE:
-            ret = addr_match_zigbee(p_frame);
+            if (m_neighbors.enabled && nrf_802154_frame_parser_mhr_parse(p_frame, &mhr_fields))
+            {
+                ret = addr_match_zigbee(p_frame,
+                                        &mhr_fields,
+                                        neighbor_find(mhr_fields.p_src_addr,
+                                                      mhr_fields.src_addr_size ==
+                                                      EXTENDED_ADDRESS_SIZE));
+            }
+            else
+            {
+                ret = addr_match_zigbee(p_frame, NULL, NULL);
+            }
             break;
 
         case NRF_802154_SRC_ADDR_MATCH_ALWAYS_1:
@@ -709,29 +1527,64 @@ bool nrf_802154_ack_data_pending_bit_should_be_set(const uint8_t * p_frame)
     return ret;
 }
 
+bool nrf_802154_ack_data_pending_bit_get(const uint8_t                            * p_frame,
+                                         const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields)
+{
+    const neighbor_data_t * p_neighbor = NULL;
+
+    if (NULL != p_mhr_fields)
+    {
+        p_neighbor = neighbor_find(p_mhr_fields->p_src_addr,
+                                   p_mhr_fields->src_addr_size == EXTENDED_ADDRESS_SIZE);
+    }
+
+    return pending_bit_get(p_frame, p_mhr_fields, p_neighbor);
+}
+
 const uint8_t * nrf_802154_ack_data_ie_get(const uint8_t * p_src_addr,
                                            bool            src_addr_extended,
                                            uint8_t       * p_ie_length)
 {
-    uint32_t location;
+    const neighbor_data_t * p_neighbor;
 
     if (NULL == p_src_addr)
     {
         return NULL;
     }
 
-    if (addr_index_find(p_src_addr, &location, NRF_802154_ACK_DATA_IE, src_addr_extended))
+    p_neighbor = neighbor_find(p_src_addr, src_addr_extended);
+
+    if (neighbor_has_data(p_neighbor, NRF_802154_ACK_DATA_IE))
     {
-        if (src_addr_extended)
-        {
-            *p_ie_length = m_ie.ext_data[location].ie_data.len;
-            return m_ie.ext_data[location].ie_data.p_data;
-        }
-        else
-        {
-            *p_ie_length = m_ie.short_data[location].ie_data.len;
-            return m_ie.short_data[location].ie_data.p_data;
-        }
+        *p_ie_length = p_neighbor->ie_data.len;
+        return p_neighbor->ie_data.p_data;
+    }
+    else
+    {
+        *p_ie_length = 0;
+        return NULL;
+    }
+}
+
+const uint8_t * nrf_802154_ack_data_get(const uint8_t                            * p_frame,
+                                        const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields,
+                                        bool                                     * p_pending_bit,
+                                        uint8_t                                  * p_ie_length)
+{
+    const neighbor_data_t * p_neighbor = NULL;
+
+    if (NULL != p_mhr_fields)
+    {
+        p_neighbor = neighbor_find(p_mhr_fields->p_src_addr,
+                                   p_mhr_fields->src_addr_size == EXTENDED_ADDRESS_SIZE);
+    }
+
+    *p_pending_bit = pending_bit_get(p_frame, p_mhr_fields, p_neighbor);
+
+    if (neighbor_has_data(p_neighbor, NRF_802154_ACK_DATA_IE))
+    {
+        *p_ie_length = p_neighbor->ie_data.len;
+        return p_neighbor->ie_data.p_data;
     }
     else
     {
@@ -40,6 +40,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "mac_features/nrf_802154_frame_parser.h"
 #include "nrf_802154_types.h"
 
 /**
@@ -92,6 +93,52 @@ bool nrf_802154_ack_data_for_addr_set(const uint8_t * p_addr,
  */
 bool nrf_802154_ack_data_for_addr_clear(const uint8_t * p_addr, bool extended, uint8_t data_type);
 
+/**
+ * @brief Adds multiple addresses to the ACK data list.
+ *
+ * The addresses are sorted once and merged into the list in a single pass. Either all addresses
+ * are added, or the list is left unmodified. Duplicated addresses are added once.
+ *
+ * @note The array pointed by @p p_addrs is sorted in place.
+ *
+ * @param[inout]  p_addrs    Pointer to the array of addresses that are to be added to the list.
+ * @param[in]     num_addrs  Number of addresses in @p p_addrs.
+ * @param[in]     extended   Indication if @p p_addrs contains extended or short addresses.
+ * @param[in]     data_type  Type of data that is to be set for every address in @p p_addrs.
+ * @param[in]     p_data     Pointer to the data to be set for every address.
+ * @param[in]     data_len   Length of the @p p_data buffer.
+ *
+ * @retval true   All addresses successfully added to the list.
+ * @retval false  Addresses not added to the list (not enough space in the list).
+ */
+bool nrf_802154_ack_data_for_addr_set_batch(uint8_t       * p_addrs,
+                                            uint32_t        num_addrs,
+                                            bool            extended,
+                                            uint8_t         data_type,
+                                            const void    * p_data,
+                                            uint8_t         data_len);
+
+/**
+ * @brief Removes multiple addresses from the ACK data list.
+ *
+ * The addresses are sorted once and removed from the list in a single pass.
+ *
+ * @note The array pointed by @p p_addrs is sorted in place.
+ *
+ * @param[inout]  p_addrs    Pointer to the array of addresses that are to be removed from the list.
+ * @param[in]     num_addrs  Number of addresses in @p p_addrs.
+ * @param[in]     extended   Indication if @p p_addrs contains extended or short addresses.
+ * @param[in]     data_type  Type of data that is to be cleared for every address in @p p_addrs.
+ *
+ * @retval true   All addresses successfully removed from the list.
+ * @retval false  At least one address was missing from the list. The remaining addresses
+ *                have been removed.
+ */
+bool nrf_802154_ack_data_for_addr_clear_batch(uint8_t * p_addrs,
+                                              uint32_t  num_addrs,
+                                              bool      extended,
+                                              uint8_t   data_type);
+
 /**
  * @brief Removes all addresses of a given length from the ACK data list.
  *
@@ -124,6 +171,22 @@ void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_
  */
 bool nrf_802154_ack_data_pending_bit_should_be_set(const uint8_t * p_frame);
 
+/**
+ * @brief Checks if a pending bit is to be set in the ACK frame sent in response to a given frame.
+ *
+ * This function works like @ref nrf_802154_ack_data_pending_bit_should_be_set, but uses
+ * the MAC header of the frame parsed by the caller.
+ *
+ * @param[in]  p_frame       Pointer to the frame for which the ACK frame is being prepared.
+ * @param[in]  p_mhr_fields  Pointer to the parsed MAC header of @p p_frame or NULL if the header
+ *                           could not be parsed.
+ *
+ * @retval true   Pending bit is to be set.
+ * @retval false  Pending bit is to be cleared.
+ */
+bool nrf_802154_ack_data_pending_bit_get(const uint8_t                            * p_frame,
+                                         const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields);
+
 /**
  * @brief Gets the IE data stored in the list for the source address of the provided frame.
  *
@@ -137,4 +200,24 @@ const uint8_t * nrf_802154_ack_data_ie_get(const uint8_t * p_src_addr,
                                            bool            src_addr_ext,
                                            uint8_t       * p_ie_length);
 
+/**
+ * @brief Gets the pending bit and the IE data for the ACK frame sent in response to a given frame.
+ *
+ * The source address of the frame is searched for in the list only once to get both values.
+ * This function is equivalent to calling @ref nrf_802154_ack_data_pending_bit_should_be_set and
+ * @ref nrf_802154_ack_data_ie_get.
+ *
+ * @param[in]  p_frame        Pointer to the frame for which the ACK frame is being prepared.
+ * @param[in]  p_mhr_fields   Pointer to the parsed MAC header of @p p_frame or NULL if the header
+ *                            could not be parsed.
+ * @param[out] p_pending_bit  Indication if the pending bit is to be set.
+ * @param[out] p_ie_length    Length of the IE data.
+ *
+ * @returns  Either pointer to the stored IE data or NULL if the IE data is not to be set.
+ */
+const uint8_t * nrf_802154_ack_data_get(const uint8_t                            * p_frame,
+                                        const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields,
+                                        bool                                     * p_pending_bit,
+                                        uint8_t                                  * p_ie_length);
+
 #endif // NRF_802154_ACK_DATA_H
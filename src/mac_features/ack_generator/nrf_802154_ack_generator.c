@@ -37,6 +37,7 @@
 #include "nrf_802154_ack_generator.h"
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdlib.h>
 
 #include "nrf_802154_const.h"
@@ -50,6 +51,8 @@ typedef enum
     FRAME_VERSION_INVALID
 } frame_version_t;
 
+static const uint8_t * mp_prepared_frame; ///< Frame for which an ACK is being prepared in advance.
+
 static frame_version_t frame_version_is_2015_or_above(const uint8_t * p_frame)
 {
     switch (p_frame[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK)
@@ -71,20 +74,54 @@ void nrf_802154_ack_generator_init(void)
     // Both generators are initialized to enable sending both Imm-Acks and Enh-Acks.
     nrf_802154_imm_ack_generator_init();
     nrf_802154_enh_ack_generator_init();
+
+    mp_prepared_frame = NULL;
 }
 
-const uint8_t * nrf_802154_ack_generator_create(const uint8_t * p_frame)
+void nrf_802154_ack_generator_prepare(
+    const uint8_t                            * p_frame,
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields,
+    uint8_t                                  * p_num_bytes)
 {
+    switch (frame_version_is_2015_or_above(p_frame))
+    {
+        case FRAME_VERSION_BELOW_2015:
+            nrf_802154_imm_ack_generator_prepare(p_frame);
+            mp_prepared_frame = p_frame;
+            break;
+
+        case FRAME_VERSION_2015_OR_ABOVE:
+            nrf_802154_enh_ack_generator_prepare(p_frame, p_mhr_fields, p_num_bytes);
+            mp_prepared_frame = p_frame;
+            break;
+
+        default:
+            mp_prepared_frame = NULL;
+            break;
+    }
+}
+
+const uint8_t * nrf_802154_ack_generator_create(
+    const uint8_t                            * p_frame,
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields)
+{
+    bool prepared = (p_frame == mp_prepared_frame);
+
     // This function should not be called if ACK is not requested.
     assert(p_frame[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT);
 
+    mp_prepared_frame = NULL;
+
     switch (frame_version_is_2015_or_above(p_frame))
     {
         case FRAME_VERSION_BELOW_2015:
-            return nrf_802154_imm_ack_generator_create(p_frame);
+            // Only the Frame Pending bit is left to be set in the prepared Imm-Ack.
+            return prepared ? nrf_802154_imm_ack_generator_finalize(p_frame, p_mhr_fields) :
+                   nrf_802154_imm_ack_generator_create(p_frame, p_mhr_fields);
 
         case FRAME_VERSION_2015_OR_ABOVE:
-            return nrf_802154_enh_ack_generator_create(p_frame);
+            return prepared ? nrf_802154_enh_ack_generator_finalize(p_frame, p_mhr_fields) :
+                   nrf_802154_enh_ack_generator_create(p_frame, p_mhr_fields);
 
         default:
             return NULL;
@@ -38,17 +38,43 @@
 
 #include <stdint.h>
 
+#include "mac_features/nrf_802154_frame_parser.h"
+
 /** Initializes the ACK generator module. */
 void nrf_802154_ack_generator_init(void);
 
 /** Creates an ACK in response to the provided frame and inserts it into a radio buffer.
  *
- * @param [in]  p_frame  Pointer to the buffer that contains PHR and PSDU of the frame
- *                       to respond to.
+ * @param [in]  p_frame       Pointer to the buffer that contains PHR and PSDU of the frame
+ *                           to respond to.
+ * @param [in]  p_mhr_fields  Pointer to the parsed MAC header of @p p_frame, or NULL if the header
+ *                           could not be parsed.
  *
  * @returns  Either pointer to a constant buffer that contains PHR and PSDU
  *           of the created ACK frame, or NULL in case of an invalid frame.
  */
-const uint8_t * nrf_802154_ack_generator_create(const uint8_t * p_frame);
+const uint8_t * nrf_802154_ack_generator_create(
+    const uint8_t                            * p_frame,
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields);
+
+/** Prepares an ACK in response to the provided frame while the frame is still being received.
+ *
+ * The function is to be called for the first time once the frame passes filtering and again
+ * each time the frame is received up to the number of bytes requested by the previous call.
+ * If the ACK is prepared, the next call to @ref nrf_802154_ack_generator_create for the same
+ * frame only completes the parts of the ACK that depend on the whole frame.
+ *
+ * @param [in]     p_frame       Pointer to the buffer that contains PHR and the received part
+ *                               of PSDU of the frame to respond to.
+ * @param [in]     p_mhr_fields  Pointer to the parsed MAC header of @p p_frame, or NULL if
+ *                               the header could not be parsed.
+ * @param [inout]  p_num_bytes   Number of bytes of the frame already received, including PHR.
+ *                               Updated to the number of bytes needed to continue preparing
+ *                               the ACK, or left unchanged if there is nothing more to prepare.
+ */
+void nrf_802154_ack_generator_prepare(
+    const uint8_t                            * p_frame,
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields,
+    uint8_t                                  * p_num_bytes);
 
 #endif // NRF_802154_ACK_GENERATOR_H
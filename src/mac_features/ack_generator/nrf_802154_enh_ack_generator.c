@@ -46,8 +46,22 @@
 
 #define ENH_ACK_MAX_SIZE MAX_PACKET_SIZE
 
+/** Stages of creating the ACK in advance, while the frame to respond to is being received. */
+typedef enum
+{
+    ACK_STAGE_NONE,       ///< The ACK is not created.
+    ACK_STAGE_ADDRESSING, ///< The part of the ACK depending on the addressing fields is created.
+    ACK_STAGE_READY,      ///< The ACK is created.
+} ack_stage_t;
+
 static uint8_t m_ack_data[ENH_ACK_MAX_SIZE + PHR_SIZE];
 
+static const nrf_802154_frame_parser_mhr_data_t * mp_frame_offsets; ///< MAC header fields of the frame to respond to.
+static nrf_802154_frame_parser_mhr_data_t         m_ack_offsets;    ///< MAC header fields of the ACK being created.
+static const uint8_t                            * mp_ie_data;       ///< IE data to be inserted into the ACK.
+static uint8_t                                    m_ie_data_len;    ///< Length of the IE data to be inserted into the ACK.
+static ack_stage_t                                m_ack_stage;      ///< Stage of creating the ACK in advance.
+
 static void ack_buffer_clear(void)
 {
     memset(m_ack_data, 0, FCF_SIZE + PHR_SIZE);
@@ -76,9 +90,9 @@ static void fcf_security_enabled_set(const uint8_t * p_frame)
         (p_frame[SECURITY_ENABLED_OFFSET] & SECURITY_ENABLED_BIT);
 }
 
-static void fcf_frame_pending_set(const uint8_t * p_frame)
+static void fcf_frame_pending_set(bool pending_bit)
 {
-    if (nrf_802154_ack_data_pending_bit_should_be_set(p_frame))
+    if (pending_bit)
     {
         m_ack_data[FRAME_PENDING_OFFSET] |= FRAME_PENDING_BIT;
     }
@@ -100,7 +114,7 @@ static void fcf_sequence_number_suppression_set(const uint8_t * p_frame)
     }
 }
 
-static void fcf_ie_present_set(const uint8_t * p_frame, const uint8_t * p_ie_data)
+static void fcf_ie_present_set(const uint8_t * p_ie_data)
 {
     if (p_ie_data != NULL)
     {
@@ -124,7 +138,7 @@ static void fcf_dst_addressing_mode_set(const uint8_t * p_frame)
     }
 }
 
-static void fcf_src_addressing_mode_set(const uint8_t * p_frame)
+static void fcf_src_addressing_mode_set(void)
 {
     m_ack_data[SRC_ADDR_TYPE_OFFSET] |= SRC_ADDR_TYPE_NONE;
 }
@@ -136,19 +150,20 @@ static void fcf_frame_version_set(void)
 
 static void frame_control_set(const uint8_t                      * p_frame,
                               const uint8_t                      * p_ie_data,
+                              bool                                 pending_bit,
                               nrf_802154_frame_parser_mhr_data_t * p_ack_offsets)
 {
     bool parse_results;
 
     fcf_frame_type_set();
     fcf_security_enabled_set(p_frame);
-    fcf_frame_pending_set(p_frame);
+    fcf_frame_pending_set(pending_bit);
     fcf_panid_compression_set(p_frame);
     fcf_sequence_number_suppression_set(p_frame);
-    fcf_ie_present_set(p_frame, p_ie_data);
+    fcf_ie_present_set(p_ie_data);
     fcf_dst_addressing_mode_set(p_frame);
     fcf_frame_version_set();
-    fcf_src_addressing_mode_set(p_frame);
+    fcf_src_addressing_mode_set();
 
     parse_results = nrf_802154_frame_parser_mhr_parse(m_ack_data, p_ack_offsets);
     assert(parse_results);
@@ -195,7 +210,7 @@ static void destination_set(const nrf_802154_frame_parser_mhr_data_t * p_frame,
     }
 }
 
-static void source_set(const uint8_t * p_frame)
+static void source_set(void)
 {
     // Intentionally empty: source address type is None.
 }
@@ -215,6 +230,24 @@ static void security_control_set(const nrf_802154_frame_parser_mhr_data_t * p_fr
     m_ack_data[PHR_OFFSET] += SECURITY_CONTROL_SIZE;
 }
 
+static uint8_t key_id_field_size_get(uint8_t sec_ctrl)
+{
+    switch (sec_ctrl & KEY_ID_MODE_MASK)
+    {
+        case KEY_ID_MODE_1:
+            return KEY_ID_MODE_1_SIZE;
+
+        case KEY_ID_MODE_2:
+            return KEY_ID_MODE_2_SIZE;
+
+        case KEY_ID_MODE_3:
+            return KEY_ID_MODE_3_SIZE;
+
+        default:
+            return 0;
+    }
+}
+
 static void security_key_id_set(const nrf_802154_frame_parser_mhr_data_t * p_frame,
                                 const nrf_802154_frame_parser_mhr_data_t * p_ack,
                                 bool                                       fc_suppresed,
@@ -222,7 +255,7 @@ static void security_key_id_set(const nrf_802154_frame_parser_mhr_data_t * p_fra
 {
     const uint8_t * p_frame_key_id;
     const uint8_t * p_ack_key_id;
-    uint8_t         key_id_mode_size = 0;
+    uint8_t         key_id_mode_size = key_id_field_size_get(*p_ack->p_sec_ctrl);
 
     p_frame_key_id = p_frame->p_sec_ctrl + SECURITY_CONTROL_SIZE;
     p_ack_key_id   = p_ack->p_sec_ctrl + SECURITY_CONTROL_SIZE;
@@ -233,24 +266,6 @@ static void security_key_id_set(const nrf_802154_frame_parser_mhr_data_t * p_fra
         p_ack_key_id   += FRAME_COUNTER_SIZE;
     }
 
-    switch ((*p_ack->p_sec_ctrl) & KEY_ID_MODE_MASK)
-    {
-        case KEY_ID_MODE_1:
-            key_id_mode_size = KEY_ID_MODE_1_SIZE;
-            break;
-
-        case KEY_ID_MODE_2:
-            key_id_mode_size = KEY_ID_MODE_2_SIZE;
-            break;
-
-        case KEY_ID_MODE_3:
-            key_id_mode_size = KEY_ID_MODE_3_SIZE;
-            break;
-
-        default:
-            break;
-    }
-
     if (0 != key_id_mode_size)
     {
         memcpy((uint8_t *)p_ack_key_id, p_frame_key_id, key_id_mode_size);
@@ -326,54 +341,198 @@ static void ie_header_set(const uint8_t * p_ie_data, uint8_t ie_data_len, const
 }
 
 /***************************************************************************************************
- * @section Public API implementation
+ * @section Creation stages
  **************************************************************************************************/
 
-void nrf_802154_enh_ack_generator_init(void)
-{
-    // Intentionally empty.
-}
-
-const uint8_t * nrf_802154_enh_ack_generator_create(const uint8_t * p_frame)
+/**
+ * @brief Creates the part of the ACK that depends on the addressing fields of the frame.
+ *
+ * The addressing fields of @p p_frame and the first byte following them must be received.
+ *
+ * @param[in]  p_frame       Pointer to the buffer that contains PHR and PSDU of the frame
+ *                           to respond to.
+ * @param[in]  p_mhr_fields  Pointer to the parsed MAC header of @p p_frame, or NULL if the header
+ *                           could not be parsed.
+ *
+ * @retval  true   The part of the ACK was created.
+ * @retval  false  The frame is invalid.
+ */
+static bool addressing_stage_run(const uint8_t                            * p_frame,
+                                 const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields)
 {
+    bool pending_bit;
 
-    nrf_802154_frame_parser_mhr_data_t frame_offsets;
-    nrf_802154_frame_parser_mhr_data_t ack_offsets;
-    const uint8_t                    * p_sec_end    = NULL;
-    bool                               parse_result = nrf_802154_frame_parser_mhr_parse(p_frame,
-                                                                                        &frame_offsets);
-
-    if (!parse_result)
+    if (p_mhr_fields == NULL)
     {
-        return NULL;
+        return false;
     }
 
-    uint8_t         ie_data_len;
-    const uint8_t * p_ie_data = nrf_802154_ack_data_ie_get(
-        frame_offsets.p_src_addr,
-        frame_offsets.src_addr_size == EXTENDED_ADDRESS_SIZE,
-        &ie_data_len);
+    mp_frame_offsets = p_mhr_fields;
+    mp_ie_data       = nrf_802154_ack_data_get(p_frame, p_mhr_fields, &pending_bit, &m_ie_data_len);
 
     // Clear previously created ACK.
     ack_buffer_clear();
 
     // Set Frame Control field bits.
-    frame_control_set(p_frame, p_ie_data, &ack_offsets);
+    frame_control_set(p_frame, mp_ie_data, pending_bit, &m_ack_offsets);
 
     // Set valid sequence number in ACK frame.
     sequence_number_set(p_frame);
 
     // Set destination address and PAN ID.
-    destination_set(&frame_offsets, &ack_offsets);
+    destination_set(mp_frame_offsets, &m_ack_offsets);
 
     // Set source address and PAN ID.
-    source_set(p_frame);
+    source_set();
+
+    return true;
+}
+
+/**
+ * @brief Creates the part of the ACK that depends on the auxiliary security header of the frame.
+ *
+ * The auxiliary security header of the frame must be received and @ref addressing_stage_run
+ * must be completed for the frame.
+ */
+static void security_stage_run(void)
+{
+    const uint8_t * p_sec_end = NULL;
 
     // Set auxiliary security header.
-    security_header_set(&frame_offsets, &ack_offsets, &p_sec_end);
+    security_header_set(mp_frame_offsets, &m_ack_offsets, &p_sec_end);
 
     // Set IE header.
-    ie_header_set(p_ie_data, ie_data_len, p_sec_end);
+    ie_header_set(mp_ie_data, m_ie_data_len, p_sec_end);
+}
+
+/**
+ * @brief Gets the number of bytes of the frame needed by @ref security_stage_run.
+ *
+ * @param[in]  p_mhr_fields  Pointer to the parsed MAC header of the frame. The security control
+ *                           field of the frame, if present, must be received.
+ *
+ * @returns  Number of bytes of the frame, including PHR, that end the auxiliary security header.
+ */
+static uint8_t security_stage_num_bytes_get(
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields)
+{
+    uint8_t sec_ctrl;
+    uint8_t num_bytes;
+
+    if (p_mhr_fields->p_sec_ctrl == NULL)
+    {
+        // No auxiliary security header. The byte following the addressing fields is needed anyway.
+        return p_mhr_fields->addressing_end_offset + 1;
+    }
+
+    sec_ctrl  = *p_mhr_fields->p_sec_ctrl;
+    num_bytes = p_mhr_fields->addressing_end_offset + SECURITY_CONTROL_SIZE;
+
+    if (!(sec_ctrl & FRAME_COUNTER_SUPPRESS_BIT))
+    {
+        num_bytes += FRAME_COUNTER_SIZE;
+    }
+
+    return num_bytes + key_id_field_size_get(sec_ctrl);
+}
+
+/***************************************************************************************************
+ * @section Public API implementation
+ **************************************************************************************************/
+
+void nrf_802154_enh_ack_generator_init(void)
+{
+    m_ack_stage = ACK_STAGE_NONE;
+}
+
+void nrf_802154_enh_ack_generator_prepare(
+    const uint8_t                            * p_frame,
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields,
+    uint8_t                                  * p_num_bytes)
+{
+    uint8_t frame_num_bytes = p_frame[PHR_OFFSET] + PHR_SIZE;
+    uint8_t addressing_num_bytes;
+    uint8_t security_num_bytes;
+
+    if ((p_mhr_fields == NULL) || (p_mhr_fields->addressing_end_offset >= frame_num_bytes))
+    {
+        // Invalid frame. The ACK is going to be created from scratch, if at all.
+        m_ack_stage = ACK_STAGE_NONE;
+        return;
+    }
+
+    // The first byte following the addressing fields is either the security control field or
+    // the command identifier checked by the ACK data module.
+    addressing_num_bytes = p_mhr_fields->addressing_end_offset + 1;
+
+    if (*p_num_bytes < addressing_num_bytes)
+    {
+        // Addressing fields of a new frame are being received.
+        m_ack_stage  = ACK_STAGE_NONE;
+        *p_num_bytes = addressing_num_bytes;
+        return;
+    }
+
+    security_num_bytes = security_stage_num_bytes_get(p_mhr_fields);
+
+    if (security_num_bytes > frame_num_bytes)
+    {
+        m_ack_stage = ACK_STAGE_NONE;
+        return;
+    }
+
+    if (m_ack_stage == ACK_STAGE_NONE)
+    {
+        if (!addressing_stage_run(p_frame, p_mhr_fields))
+        {
+            return;
+        }
+
+        m_ack_stage = ACK_STAGE_ADDRESSING;
+    }
+
+    if (*p_num_bytes < security_num_bytes)
+    {
+        // Auxiliary security header is being received.
+        *p_num_bytes = security_num_bytes;
+        return;
+    }
+
+    if (m_ack_stage == ACK_STAGE_ADDRESSING)
+    {
+        security_stage_run();
+
+        m_ack_stage = ACK_STAGE_READY;
+    }
+}
+
+const uint8_t * nrf_802154_enh_ack_generator_finalize(
+    const uint8_t                            * p_frame,
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields)
+{
+    if (m_ack_stage == ACK_STAGE_READY)
+    {
+        // FCS is the only part of the ACK left and it is calculated by RADIO.
+        m_ack_stage = ACK_STAGE_NONE;
+
+        return m_ack_data;
+    }
+
+    return nrf_802154_enh_ack_generator_create(p_frame, p_mhr_fields);
+}
+
+const uint8_t * nrf_802154_enh_ack_generator_create(
+    const uint8_t                            * p_frame,
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields)
+{
+    m_ack_stage = ACK_STAGE_NONE;
+
+    if (!addressing_stage_run(p_frame, p_mhr_fields))
+    {
+        return NULL;
+    }
+
+    security_stage_run();
 
     return m_ack_data;
 }
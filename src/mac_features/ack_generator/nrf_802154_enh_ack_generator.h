@@ -40,6 +40,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "mac_features/nrf_802154_frame_parser.h"
+
 /** Initializes the Enhanced ACK generator module. */
 void nrf_802154_enh_ack_generator_init(void);
 
@@ -47,12 +49,54 @@ void nrf_802154_enh_ack_generator_init(void);
  *
  * This function creates an Enhanced ACK frame and inserts it into a radio buffer.
  *
- * @param [in]  p_frame  Pointer to the buffer that contains PHR and PSDU of the frame
- *                       to respond to.
+ * @param [in]  p_frame       Pointer to the buffer that contains PHR and PSDU of the frame
+ *                           to respond to.
+ * @param [in]  p_mhr_fields  Pointer to the parsed MAC header of @p p_frame, or NULL if the header
+ *                           could not be parsed.
+ *
+ * @returns  Either pointer to a constant buffer that contains PHR and PSDU
+ *           of the created Enhanced ACK frame, or NULL in case of an invalid frame.
+ */
+const uint8_t * nrf_802154_enh_ack_generator_create(
+    const uint8_t                            * p_frame,
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields);
+
+/** Creates an Enhanced ACK in response to the provided frame while the frame is being received.
+ *
+ * The Enhanced ACK is created in stages, each run when the part of the frame it depends on
+ * is received. The function is to be called for the first time once the frame passes
+ * filtering and again each time the frame is received up to the number of bytes requested
+ * by the previous call. The created Enhanced ACK is retrieved with
+ * @ref nrf_802154_enh_ack_generator_finalize.
+ *
+ * @param [in]     p_frame       Pointer to the buffer that contains PHR and the received part
+ *                               of PSDU of the frame to respond to.
+ * @param [in]     p_mhr_fields  Pointer to the parsed MAC header of @p p_frame, or NULL if
+ *                               the header could not be parsed.
+ * @param [inout]  p_num_bytes   Number of bytes of the frame already received, including PHR.
+ *                               Updated to the number of bytes needed to run the next stage,
+ *                               or left unchanged if there are no more stages to run.
+ */
+void nrf_802154_enh_ack_generator_prepare(
+    const uint8_t                            * p_frame,
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields,
+    uint8_t                                  * p_num_bytes);
+
+/** Completes the Enhanced ACK created with @ref nrf_802154_enh_ack_generator_prepare.
+ *
+ * If not all stages were run, the Enhanced ACK is created from scratch, as with
+ * @ref nrf_802154_enh_ack_generator_create.
+ *
+ * @param [in]  p_frame       Pointer to the buffer that contains PHR and PSDU of the frame
+ *                           to respond to.
+ * @param [in]  p_mhr_fields  Pointer to the parsed MAC header of @p p_frame, or NULL if the header
+ *                           could not be parsed.
  *
- * @returns  Pointer to a constant buffer that contains PHR and PSDU
- *           of the created Enhanced ACK frame.
+ * @returns  Either pointer to a constant buffer that contains PHR and PSDU
+ *           of the created Enhanced ACK frame, or NULL in case of an invalid frame.
  */
-const uint8_t * nrf_802154_enh_ack_generator_create(const uint8_t * p_frame);
+const uint8_t * nrf_802154_enh_ack_generator_finalize(
+    const uint8_t                            * p_frame,
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields);
 
 #endif // NRF_802154_ENH_ACK_GENERATOR_H
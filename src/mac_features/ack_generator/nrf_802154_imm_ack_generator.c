@@ -53,13 +53,18 @@ void nrf_802154_imm_ack_generator_init(void)
     memcpy(m_ack_data, ack_data, sizeof(ack_data));
 }
 
-const uint8_t * nrf_802154_imm_ack_generator_create(const uint8_t * p_frame)
+void nrf_802154_imm_ack_generator_prepare(const uint8_t * p_frame)
 {
     // Set valid sequence number in ACK frame.
     m_ack_data[DSN_OFFSET] = p_frame[DSN_OFFSET];
+}
 
+const uint8_t * nrf_802154_imm_ack_generator_finalize(
+    const uint8_t                            * p_frame,
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields)
+{
     // Set pending bit in ACK frame.
-    if (nrf_802154_ack_data_pending_bit_should_be_set(p_frame))
+    if (nrf_802154_ack_data_pending_bit_get(p_frame, p_mhr_fields))
     {
         m_ack_data[FRAME_PENDING_OFFSET] = ACK_HEADER_WITH_PENDING;
     }
@@ -70,3 +75,12 @@ const uint8_t * nrf_802154_imm_ack_generator_create(const uint8_t * p_frame)
 
     return m_ack_data;
 }
+
+const uint8_t * nrf_802154_imm_ack_generator_create(
+    const uint8_t                            * p_frame,
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields)
+{
+    nrf_802154_imm_ack_generator_prepare(p_frame);
+
+    return nrf_802154_imm_ack_generator_finalize(p_frame, p_mhr_fields);
+}
@@ -40,6 +40,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "mac_features/nrf_802154_frame_parser.h"
+
 /** Initializes the Immediate ACK generator module. */
 void nrf_802154_imm_ack_generator_init(void);
 
@@ -47,12 +49,43 @@ void nrf_802154_imm_ack_generator_init(void);
  *
  *  This function creates an Immediate ACK frame and inserts it into a radio buffer.
  *
- * @param [in]  p_frame  Pointer to the buffer that contains PHR and PSDU of the frame
- *                       to respond to.
+ * @param [in]  p_frame       Pointer to the buffer that contains PHR and PSDU of the frame
+ *                           to respond to.
+ * @param [in]  p_mhr_fields  Pointer to the parsed MAC header of @p p_frame, or NULL if the header
+ *                           could not be parsed.
+ *
+ * @returns  Pointer to a constant buffer that contains PHR and PSDU of the created
+ *           Immediate ACK frame.
+ */
+const uint8_t * nrf_802154_imm_ack_generator_create(
+    const uint8_t                            * p_frame,
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields);
+
+/** Prepares an Immediate ACK in response to the provided frame before the frame is received.
+ *
+ *  This function fills the parts of the Immediate ACK frame that depend only on the MAC header
+ *  of the frame. The Immediate ACK must be completed with
+ *  @ref nrf_802154_imm_ack_generator_finalize once the whole frame is received.
+ *
+ * @param [in]  p_frame  Pointer to the buffer that contains PHR and at least the MAC header
+ *                       of the frame to respond to.
+ */
+void nrf_802154_imm_ack_generator_prepare(const uint8_t * p_frame);
+
+/** Completes the Immediate ACK prepared with @ref nrf_802154_imm_ack_generator_prepare.
+ *
+ *  This function sets the Frame Pending bit of the Immediate ACK frame.
+ *
+ * @param [in]  p_frame       Pointer to the buffer that contains PHR and PSDU of the frame
+ *                           to respond to.
+ * @param [in]  p_mhr_fields  Pointer to the parsed MAC header of @p p_frame, or NULL if the header
+ *                           could not be parsed.
  *
  * @returns  Pointer to a constant buffer that contains PHR and PSDU of the created
  *           Immediate ACK frame.
  */
-const uint8_t * nrf_802154_imm_ack_generator_create(const uint8_t * p_frame);
+const uint8_t * nrf_802154_imm_ack_generator_finalize(
+    const uint8_t                            * p_frame,
+    const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields);
 
 #endif // NRF_802154_IMM_ACK_GENERATOR_H
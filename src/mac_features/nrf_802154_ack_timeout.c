@@ -41,10 +41,15 @@
 #include <stdint.h>
 
 #include "../nrf_802154_debug.h"
+#include "nrf_802154_config.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_request.h"
 #include "timer_scheduler/nrf_802154_timer_sched.h"
 
+#if NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+#error "Adaptive ACK timeout is implemented only by nrf_802154_precise_ack_timeout.c"
+#endif
+
 #define RETRY_DELAY     500     ///< Procedure is delayed by this time if cannot be performed at the moment.
 #define MAX_RETRY_DELAY 1000000 ///< Maximal allowed delay of procedure retry.
 
@@ -92,7 +97,7 @@ static void timeout_timer_retry(void)
     m_timer.dt += RETRY_DELAY;
     assert(m_timer.dt <= MAX_RETRY_DELAY);
 
-    nrf_802154_timer_sched_add(&m_timer, true);
+    nrf_802154_timer_sched_add_with_slack(&m_timer, true, NRF_802154_ACK_TIMEOUT_SLACK);
 }
 
 static void timeout_timer_start(void)
@@ -104,7 +109,7 @@ static void timeout_timer_start(void)
 
     m_procedure_is_active = true;
 
-    nrf_802154_timer_sched_add(&m_timer, true);
+    nrf_802154_timer_sched_add_with_slack(&m_timer, true, NRF_802154_ACK_TIMEOUT_SLACK);
 }
 
 static void timeout_timer_stop(void)
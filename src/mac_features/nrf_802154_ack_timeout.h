@@ -52,6 +52,15 @@
  */
 void nrf_802154_ack_timeout_time_set(uint32_t time);
 
+/**
+ * @brief Gets the ACK delays measured by the adaptive ACK timeout.
+ *
+ * Only the precise ACK timeout implementation provides this function.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled with the measured delays.
+ */
+void nrf_802154_ack_timeout_time_stats_get(nrf_802154_ack_timeout_stats_t * p_stats);
+
 /**
  * @brief Aborts a started ACK timeout procedure.
  *
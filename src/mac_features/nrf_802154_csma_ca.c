@@ -45,18 +45,28 @@
 #include "nrf_802154_const.h"
 #include "../nrf_802154_debug.h"
 #include "nrf_802154_notification.h"
+#include "nrf_802154_pib.h"
 #include "nrf_802154_request.h"
 #include "platform/random/nrf_802154_random.h"
 #include "timer_scheduler/nrf_802154_timer_sched.h"
 
 #if NRF_802154_CSMA_CA_ENABLED
 
+#if NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS > CSMA_CA_MAX_BACKOFFS_LIMIT
+#error "NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS must not exceed 5"
+#endif
+
 static uint8_t m_nb;                    ///< The number of times the CSMA-CA algorithm was required to back off while attempting the current transmission.
 static uint8_t m_be;                    ///< Backoff exponent, which is related to how many backoff periods a device shall wait before attempting to assess a channel.
 
+static nrf_802154_csma_ca_params_t m_params; ///< Parameters of the current CSMA-CA procedure.
+
 static const uint8_t    * mp_data;      ///< Pointer to a buffer containing PHR and PSDU of the frame being transmitted.
 static nrf_802154_timer_t m_timer;      ///< Timer used to back off during CSMA-CA procedure.
 static bool               m_is_running; ///< Indicates if CSMA-CA procedure is running.
+#if NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+static bool               m_hw_backoff; ///< Indicates if a backoff already counted in NB is timed by the core.
+#endif // NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
 
 /**
  * @brief Perform appropriate actions for busy channel conditions.
@@ -87,6 +97,31 @@ static bool procedure_is_running(void)
 static void procedure_stop(void)
 {
     m_is_running = false;
+#if NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+    m_hw_backoff = false;
+#endif // NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+}
+
+/**
+ * @brief Check if the given number of backoffs reaches macMaxCsmaBackoffs.
+ *
+ * The value of zero allows a single backoff, like the value of one.
+ *
+ * @param[in]  nb  Number of backoffs.
+ *
+ * @retval true   No more backoffs are allowed.
+ * @retval false  Another backoff can be performed.
+ */
+static bool backoff_limit_is_reached(uint32_t nb)
+{
+    uint32_t max_csma_backoffs = m_params.max_csma_backoffs;
+
+    if (max_csma_backoffs == 0)
+    {
+        max_csma_backoffs = 1;
+    }
+
+    return nb >= max_csma_backoffs;
 }
 
 /**
@@ -96,7 +131,7 @@ static void procedure_stop(void)
  */
 static void notify_busy_channel(bool result)
 {
-    if (!result && (m_nb >= (NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS - 1)))
+    if (!result && backoff_limit_is_reached(m_nb + 1))
     {
         nrf_802154_notify_transmit_failed(mp_data, NRF_802154_TX_ERROR_BUSY_CHANNEL);
     }
@@ -134,18 +169,53 @@ static void frame_transmit(void * p_context)
 }
 
 /**
- * @brief Delay CCA procedure for random (2^BE - 1) unit backoff periods.
+ * @brief Draw random (2^BE - 1) unit backoff periods.
+ *
+ * @return Duration of the backoff in microseconds.
  */
-static void random_backoff_start(void)
+static uint32_t random_backoff_get(void)
 {
     uint8_t backoff_periods = nrf_802154_random_get() % (1 << m_be);
 
+    return backoff_periods * UNIT_BACKOFF_PERIOD;
+}
+
+/**
+ * @brief Delay CCA procedure for random (2^BE - 1) unit backoff periods.
+ */
+static void random_backoff_start(void)
+{
     m_timer.callback  = frame_transmit;
     m_timer.p_context = NULL;
     m_timer.t0        = nrf_802154_timer_sched_time_get();
-    m_timer.dt        = backoff_periods * UNIT_BACKOFF_PERIOD;
+    m_timer.dt        = random_backoff_get();
 
-    nrf_802154_timer_sched_add(&m_timer, false);
+    nrf_802154_timer_sched_add_with_slack(&m_timer, false, NRF_802154_CSMA_CA_BACKOFF_SLACK);
+}
+
+/**
+ * @brief Increment NB and BE after the channel was found busy.
+ *
+ * @retval true   Next backoff should be performed.
+ * @retval false  NB reached macMaxCsmaBackoffs and the procedure is stopped.
+ */
+static bool backoff_counters_update(void)
+{
+    m_nb++;
+
+    if (m_be < m_params.max_be)
+    {
+        m_be++;
+    }
+
+    if (!backoff_limit_is_reached(m_nb))
+    {
+        return true;
+    }
+
+    procedure_stop();
+
+    return false;
 }
 
 static bool channel_busy(void)
@@ -156,21 +226,21 @@ static bool channel_busy(void)
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_CSMA_CHANNEL_BUSY);
 
-        m_nb++;
-
-        if (m_be < NRF_802154_CSMA_CA_MAX_BE)
+#if NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+        if (m_hw_backoff)
         {
-            m_be++;
-        }
+            // NB and BE were already updated for the backoff that the core did not complete.
+            m_hw_backoff = false;
 
-        if (m_nb < NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS)
-        {
             random_backoff_start();
             result = false;
         }
         else
+#endif // NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+        if (backoff_counters_update())
         {
-            procedure_stop();
+            random_backoff_start();
+            result = false;
         }
 
         nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_CSMA_CHANNEL_BUSY);
@@ -179,14 +249,28 @@ static bool channel_busy(void)
     return result;
 }
 
-void nrf_802154_csma_ca_start(const uint8_t * p_data)
+void nrf_802154_csma_ca_start(const uint8_t * p_data, const nrf_802154_csma_ca_params_t * p_params)
 {
     assert(!procedure_is_running());
 
+    if (p_params != NULL)
+    {
+        m_params = *p_params;
+    }
+    else
+    {
+        nrf_802154_pib_csma_ca_params_get(&m_params);
+    }
+
+    assert(m_params.min_be <= m_params.max_be);
+
     mp_data      = p_data;
     m_nb         = 0;
-    m_be         = NRF_802154_CSMA_CA_MIN_BE;
+    m_be         = m_params.min_be;
     m_is_running = true;
+#if NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+    m_hw_backoff = false;
+#endif // NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
 
     random_backoff_start();
 }
@@ -255,4 +339,29 @@ bool nrf_802154_csma_ca_tx_started_hook(const uint8_t * p_frame)
     return true;
 }
 
+#if NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+
+bool nrf_802154_csma_ca_tx_busy_channel_hook(const uint8_t * p_frame, uint32_t * p_backoff)
+{
+    bool result = false;
+
+    if ((p_frame == mp_data) && procedure_is_running())
+    {
+        nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_CSMA_TX_BUSY_CHANNEL);
+
+        if (backoff_counters_update())
+        {
+            *p_backoff   = random_backoff_get();
+            m_hw_backoff = true;
+            result       = true;
+        }
+
+        nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_CSMA_TX_BUSY_CHANNEL);
+    }
+
+    return result;
+}
+
+#endif // NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+
 #endif // NRF_802154_CSMA_CA_ENABLED
@@ -58,8 +58,10 @@
  *
  * @param[in]  p_data    Pointer to a buffer the contains PHR and PSDU of the frame
  *                       that is to be transmitted.
+ * @param[in]  p_params  Pointer to the CSMA-CA parameters used for this transmission, or NULL
+ *                       to use the default parameters stored in PIB.
  */
-void nrf_802154_csma_ca_start(const uint8_t * p_data);
+void nrf_802154_csma_ca_start(const uint8_t * p_data, const nrf_802154_csma_ca_params_t * p_params);
 
 /**
  * @brief Aborts the ongoing CSMA-CA procedure.
@@ -102,6 +104,23 @@ bool nrf_802154_csma_ca_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_er
  */
 bool nrf_802154_csma_ca_tx_started_hook(const uint8_t * p_frame);
 
+/**
+ * @brief Handles a busy channel detected by the core during a CSMA-CA attempt.
+ *
+ * This hook is used when @ref NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED is set. It updates NB and BE
+ * and draws the next random backoff, which the core times with its high-resolution timer before
+ * repeating the CCA. If the core cannot time the backoff, it reports a busy channel error and
+ * @ref nrf_802154_csma_ca_tx_failed_hook times the same backoff with the timer scheduler.
+ *
+ * @param[in]   p_frame    Pointer to a buffer that contains PHR and PSDU of the frame
+ *                         that was not transmitted.
+ * @param[out]  p_backoff  Duration of the next backoff in microseconds.
+ *
+ * @retval  true   The core is to repeat the CCA after @p p_backoff.
+ * @retval  false  The frame is not transmitted by the CSMA-CA procedure or the procedure failed.
+ */
+bool nrf_802154_csma_ca_tx_busy_channel_hook(const uint8_t * p_frame, uint32_t * p_backoff);
+
 /**
  *@}
  **/
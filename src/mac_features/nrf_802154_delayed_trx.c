@@ -38,6 +38,7 @@
 
 #include <assert.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "../nrf_802154_debug.h"
@@ -48,6 +49,7 @@
 #include "nrf_802154_pib.h"
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_request.h"
+#include "nrf_802154_timer_coord.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "timer_scheduler/nrf_802154_timer_sched.h"
 
@@ -58,6 +60,31 @@
 #define TX_SETUP_TIME 160u ///< Time needed to prepare TX procedure [us]. It does not include TX ramp-up time.
 #define RX_SETUP_TIME 110u ///< Time needed to prepare RX procedure [us]. It does not include RX ramp-up time.
 
+/* When the setup time is calibrated, the measured time replaces the IRQ processing time. The time
+ * needed by other boards to detect a frame is not measured. Neither is the delay of unknown origin
+ * in case of TX, so it is kept until it is shown not to be needed.
+ */
+#define SETUP_TIME_DETECTION_MARGIN 40u                                 ///< Time needed by other boards to detect a frame [us].
+#define TX_SETUP_TIME_MARGIN        (SETUP_TIME_DETECTION_MARGIN + 50u) ///< Part of the TX setup time that is not measured [us].
+#define RX_SETUP_TIME_MARGIN        SETUP_TIME_DETECTION_MARGIN         ///< Part of the RX setup time that is not measured [us].
+
+#if NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED
+#if !NRF_802154_FRAME_TIMESTAMP_ENABLED
+#error "Setup time calibration requires NRF_802154_FRAME_TIMESTAMP_ENABLED"
+#endif
+
+#if NRF_802154_DELAYED_TRX_SETUP_TIME_WINDOW < (2 * NRF_802154_DELAYED_TRX_SETUP_TIME_MIN_SAMPLES)
+#error "NRF_802154_DELAYED_TRX_SETUP_TIME_WINDOW must be at least twice the minimal number of samples"
+#endif
+
+#if (NRF_802154_DELAYED_TRX_SETUP_TIME_PERCENTILE < 1) || \
+    (NRF_802154_DELAYED_TRX_SETUP_TIME_PERCENTILE > 100)
+#error "NRF_802154_DELAYED_TRX_SETUP_TIME_PERCENTILE must be in range 1..100"
+#endif
+#endif // NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED
+
+#define RX_WINDOWS_UNLIMITED UINT32_MAX ///< Number of remaining receive windows of a periodic reception that is not limited.
+
 /**
  * @brief States of delayed operations.
  */
@@ -80,17 +107,28 @@ typedef struct
 } delayed_rx_frame_data_t;
 
 /**
- * @brief TX delayed operation configuration.
+ * @brief TX delayed operations configuration.
+ */
+static const uint8_t * mp_tx_data[NRF_802154_DELAYED_TRX_TX_SLOTS];   ///< Pointers to buffers containing PHR and PSDU of the frames requested to be transmitted.
+static bool            m_tx_cca[NRF_802154_DELAYED_TRX_TX_SLOTS];     ///< If CCA should be performed prior to transmission.
+static uint8_t         m_tx_channel[NRF_802154_DELAYED_TRX_TX_SLOTS]; ///< Channel numbers on which transmissions should be performed.
+static uint32_t        m_tx_ts_start[NRF_802154_DELAYED_TRX_TX_SLOTS]; ///< Requested start times of the transmission timeslots.
+
+/**
+ * @brief RX delayed operations configuration.
  */
-static const uint8_t * mp_tx_data;         ///< Pointer to a buffer containing PHR and PSDU of the frame requested to be transmitted.
-static bool            m_tx_cca;           ///< If CCA should be performed prior to transmission.
-static uint8_t         m_tx_channel;       ///< Channel number on which transmission should be performed.
+static nrf_802154_timer_t m_timeout_timer[NRF_802154_DELAYED_TRX_RX_SLOTS]; ///< Timers for delayed RX timeout handling.
+static uint8_t            m_rx_channel[NRF_802154_DELAYED_TRX_RX_SLOTS];    ///< Channel numbers on which receptions should be performed.
 
 /**
- * @brief RX delayed operation configuration.
+ * @brief Periodic RX delayed operations configuration.
  */
-static nrf_802154_timer_t m_timeout_timer; ///< Timer for delayed RX timeout handling.
-static uint8_t            m_rx_channel;    ///< Channel number on which reception should be performed.
+static uint32_t m_rx_t0[NRF_802154_DELAYED_TRX_RX_SLOTS];           ///< Base time of the current receive window.
+static uint32_t m_rx_dt[NRF_802154_DELAYED_TRX_RX_SLOTS];           ///< Time delta between the base time and the receive window start.
+static uint32_t m_rx_ts_dt[NRF_802154_DELAYED_TRX_RX_SLOTS];        ///< Time delta between the base time and the timeslot start of the current receive window.
+static uint32_t m_rx_timeout[NRF_802154_DELAYED_TRX_RX_SLOTS];      ///< Length of each receive window.
+static uint32_t m_rx_period[NRF_802154_DELAYED_TRX_RX_SLOTS];       ///< Distance between starts of consecutive receive windows.
+static uint32_t m_rx_windows_left[NRF_802154_DELAYED_TRX_RX_SLOTS]; ///< Number of receive windows to schedule after the current one.
 
 /**
  * @brief State of delayed operations.
@@ -98,37 +136,230 @@ static uint8_t            m_rx_channel;    ///< Channel number on which receptio
 static volatile delayed_trx_op_state_t m_dly_op_state[RSCH_DLY_TS_NUM];
 
 /**
- * @brief RX delayed operation frame data.
+ * @brief RX delayed operations frame data.
  */
-static volatile delayed_rx_frame_data_t m_dly_rx_frame;
+static volatile delayed_rx_frame_data_t m_dly_rx_frame[NRF_802154_DELAYED_TRX_RX_SLOTS];
 
 /**
- * Set state of a delayed operation.
+ * @brief Delayed timeslot which start is being handled.
+ *
+ * Transmit and receive requests report their results synchronously, so this variable identifies
+ * the slot in the request result callbacks.
+ */
+static rsch_dly_ts_id_t m_dly_ts_starting;
+
+/**
+ * @brief Measured setup times of delayed operations.
+ */
+static nrf_802154_setup_time_t m_tx_setup_time; ///< Setup time of delayed transmissions.
+static nrf_802154_setup_time_t m_rx_setup_time; ///< Setup time of delayed receptions.
+
+#if NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED
+
+/**
+ * Get setup time that covers the configured percentile of the measured setup times.
+ *
+ * @param[in]  p_setup_time  Setup time measurements.
+ *
+ * @return  Setup time covering @ref NRF_802154_DELAYED_TRX_SETUP_TIME_PERCENTILE of measurements [us].
+ */
+static uint32_t setup_time_percentile_get(const nrf_802154_setup_time_t * p_setup_time)
+{
+    uint32_t threshold = (p_setup_time->samples * NRF_802154_DELAYED_TRX_SETUP_TIME_PERCENTILE +
+                          99) / 100;
+    uint32_t sum = 0;
+
+    for (uint32_t i = 0; i < NRF_802154_SETUP_TIME_HISTOGRAM_BINS - 1; i++)
+    {
+        sum += p_setup_time->histogram[i];
+
+        if (sum >= threshold)
+        {
+            return (i + 1) * NRF_802154_SETUP_TIME_HISTOGRAM_BIN_WIDTH;
+        }
+    }
+
+    // The last bin is not bounded.
+    return p_setup_time->max;
+}
+
+/**
+ * Add a setup time measurement of a delayed operation and update the used setup time.
+ *
+ * When the number of measurements reaches @ref NRF_802154_DELAYED_TRX_SETUP_TIME_WINDOW, all
+ * histogram bins are halved, so that the estimate follows changes of the setup time.
+ *
+ * @param[inout]  p_setup_time   Setup time measurements.
+ * @param[in]     default_time   Setup time used until enough measurements are collected [us].
+ * @param[in]     margin         Part of the setup time that is not measured [us].
+ * @param[in]     ts_start       Requested start time of the timeslot of the operation.
+ */
+static void setup_time_measure(nrf_802154_setup_time_t * p_setup_time,
+                               uint32_t                  default_time,
+                               uint32_t                  margin,
+                               uint32_t                  ts_start)
+{
+    uint32_t now;
+    int32_t  sample;
+    uint32_t bin;
+
+    if (!nrf_802154_timer_coord_time_get(&now))
+    {
+        return;
+    }
+
+    sample = (int32_t)(now - ts_start);
+
+    if (sample < 0)
+    {
+        sample = 0;
+    }
+
+    bin = (uint32_t)sample / NRF_802154_SETUP_TIME_HISTOGRAM_BIN_WIDTH;
+
+    if (bin >= NRF_802154_SETUP_TIME_HISTOGRAM_BINS)
+    {
+        bin = NRF_802154_SETUP_TIME_HISTOGRAM_BINS - 1;
+    }
+
+    if ((uint32_t)sample > p_setup_time->max)
+    {
+        p_setup_time->max = sample;
+    }
+
+    p_setup_time->histogram[bin]++;
+    p_setup_time->samples++;
+
+    if (p_setup_time->samples >= NRF_802154_DELAYED_TRX_SETUP_TIME_WINDOW)
+    {
+        p_setup_time->samples = 0;
+
+        for (uint32_t i = 0; i < NRF_802154_SETUP_TIME_HISTOGRAM_BINS; i++)
+        {
+            p_setup_time->histogram[i] /= 2;
+            p_setup_time->samples     += p_setup_time->histogram[i];
+        }
+    }
+
+    if (p_setup_time->samples >= NRF_802154_DELAYED_TRX_SETUP_TIME_MIN_SAMPLES)
+    {
+        p_setup_time->setup_time = setup_time_percentile_get(p_setup_time) + margin;
+    }
+    else
+    {
+        p_setup_time->setup_time = default_time;
+    }
+}
+
+#endif // NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED
+
+/**
+ * Get setup time used to schedule delayed operations.
+ *
+ * @param[in]  p_setup_time  Setup time of delayed operations of given type.
+ * @param[in]  default_time  Setup time used when the setup time is not calibrated [us].
+ *
+ * @return  Setup time [us].
+ */
+static inline uint32_t setup_time_get(const nrf_802154_setup_time_t * p_setup_time,
+                                      uint32_t                        default_time)
+{
+    uint32_t setup_time = p_setup_time->setup_time;
+
+    return (setup_time != 0) ? setup_time : default_time;
+}
+
+/**
+ * Copy measured setup times of delayed operations.
+ *
+ * @param[in]   p_setup_time  Setup time of delayed operations of given type.
+ * @param[in]   default_time  Setup time used when the setup time is not calibrated [us].
+ * @param[out]  p_data        Copy of the setup time measurements.
+ */
+static void setup_time_copy(const nrf_802154_setup_time_t * p_setup_time,
+                            uint32_t                        default_time,
+                            nrf_802154_setup_time_t       * p_data)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    *p_data = *p_setup_time;
+    __set_PRIMASK(primask);
+
+    p_data->setup_time = setup_time_get(p_setup_time, default_time);
+}
+
+/**
+ * Check if given delayed timeslot is used by a delayed TX operation.
+ *
+ * @param[in]  dly_ts_id  Delayed timeslot ID.
+ *
+ * @retval true   @p dly_ts_id is a TX slot.
+ * @retval false  @p dly_ts_id is an RX slot.
+ */
+static inline bool dly_ts_is_tx(rsch_dly_ts_id_t dly_ts_id)
+{
+    return dly_ts_id < RSCH_DLY_RX;
+}
+
+/**
+ * Get index of the TX operation configuration associated with given delayed timeslot.
+ *
+ * @param[in]  dly_ts_id  Delayed timeslot ID of a TX slot.
+ *
+ * @return  Index in the TX delayed operations configuration arrays.
+ */
+static inline uint32_t dly_tx_idx_get(rsch_dly_ts_id_t dly_ts_id)
+{
+    assert(dly_ts_is_tx(dly_ts_id));
+
+    return (uint32_t)dly_ts_id - RSCH_DLY_TX;
+}
+
+/**
+ * Get index of the RX operation configuration associated with given delayed timeslot.
+ *
+ * @param[in]  dly_ts_id  Delayed timeslot ID of an RX slot.
+ *
+ * @return  Index in the RX delayed operations configuration arrays.
+ */
+static inline uint32_t dly_rx_idx_get(rsch_dly_ts_id_t dly_ts_id)
+{
+    assert(!dly_ts_is_tx(dly_ts_id) && (dly_ts_id < RSCH_DLY_TS_NUM));
+
+    return (uint32_t)dly_ts_id - RSCH_DLY_RX;
+}
+
+/**
+ * Atomically change state of a delayed operation.
  *
- * @param[in]  expected_dly_rx_state   Delayed RX current expected state.
- * @param[in]  new_dly_rx_state        Delayed RX new state to be set.
+ * @param[in]  dly_ts_id       Delayed timeslot ID.
+ * @param[in]  expected_state  Delayed operation current expected state.
+ * @param[in]  new_state       Delayed operation new state to be set.
  *
  * @retval true   Successfully set the new state.
  * @retval false  Failed to set the new state.
  */
-static bool dly_rx_state_set(delayed_trx_op_state_t expected_dly_rx_state,
-                             delayed_trx_op_state_t new_dly_rx_state)
+static bool dly_op_state_cas(rsch_dly_ts_id_t       dly_ts_id,
+                             delayed_trx_op_state_t expected_state,
+                             delayed_trx_op_state_t new_state)
 {
-    volatile delayed_trx_op_state_t current_dly_rx_state;
+    volatile delayed_trx_op_state_t current_state;
+
+    assert(dly_ts_id < RSCH_DLY_TS_NUM);
 
     do
     {
-        current_dly_rx_state =
-            (delayed_trx_op_state_t)__LDREXB((uint8_t *)&m_dly_op_state[RSCH_DLY_RX]);
+        current_state = (delayed_trx_op_state_t)__LDREXB((uint8_t *)&m_dly_op_state[dly_ts_id]);
 
-        if (current_dly_rx_state != expected_dly_rx_state)
+        if (current_state != expected_state)
         {
             __CLREX();
             return false;
         }
 
     }
-    while (__STREXB((uint8_t)new_dly_rx_state, (uint8_t *)&m_dly_op_state[RSCH_DLY_RX]));
+    while (__STREXB((uint8_t)new_state, (uint8_t *)&m_dly_op_state[dly_ts_id]));
 
     __DMB();
 
@@ -162,39 +393,85 @@ static void dly_op_state_set(rsch_dly_ts_id_t       dly_ts_id,
 {
     assert(new_state < DELAYED_TRX_OP_STATE_NB);
 
-    switch (dly_ts_id)
+    bool result = dly_op_state_cas(dly_ts_id, expected_state, new_state);
+
+    assert(result);
+    (void)result;
+}
+
+/**
+ * Claim a stopped delayed TX slot.
+ *
+ * The claimed slot enters PENDING state before its timeslot is requested, in case the timeslot
+ * starts immediately and interrupts the caller.
+ *
+ * @param[out]  p_dly_ts_id  Delayed timeslot ID of the claimed slot.
+ *
+ * @retval true   A slot was claimed.
+ * @retval false  All TX slots are in use.
+ */
+static bool dly_tx_slot_claim(rsch_dly_ts_id_t * p_dly_ts_id)
+{
+    for (uint32_t i = 0; i < NRF_802154_DELAYED_TRX_TX_SLOTS; i++)
     {
-        case RSCH_DLY_TX:
+        rsch_dly_ts_id_t dly_ts_id = (rsch_dly_ts_id_t)(RSCH_DLY_TX + i);
+
+        if (dly_op_state_cas(dly_ts_id,
+                             DELAYED_TRX_OP_STATE_STOPPED,
+                             DELAYED_TRX_OP_STATE_PENDING))
         {
-            assert(m_dly_op_state[RSCH_DLY_TX] == expected_state);
-            m_dly_op_state[RSCH_DLY_TX] = new_state;
-            break;
+            *p_dly_ts_id = dly_ts_id;
+            return true;
         }
+    }
 
-        case RSCH_DLY_RX:
-        {
-            bool result = dly_rx_state_set(expected_state, new_state);
+    return false;
+}
 
-            assert(result);
-            (void)result;
-            break;
+/**
+ * Claim a stopped delayed RX slot.
+ *
+ * The claimed slot enters PENDING state before its timeslot is requested, in case the timeslot
+ * starts immediately and interrupts the caller.
+ *
+ * @param[out]  p_dly_ts_id  Delayed timeslot ID of the claimed slot.
+ *
+ * @retval true   A slot was claimed.
+ * @retval false  All RX slots are in use.
+ */
+static bool dly_rx_slot_claim(rsch_dly_ts_id_t * p_dly_ts_id)
+{
+    for (uint32_t i = 0; i < NRF_802154_DELAYED_TRX_RX_SLOTS; i++)
+    {
+        rsch_dly_ts_id_t dly_ts_id = (rsch_dly_ts_id_t)(RSCH_DLY_RX + i);
+
+        if (dly_op_state_get(dly_ts_id) != DELAYED_TRX_OP_STATE_STOPPED)
+        {
+            continue;
         }
 
-        default:
+        // remove timer in case it was left after abort operation
+        nrf_802154_timer_sched_remove(&m_timeout_timer[i], NULL);
+
+        if (dly_op_state_cas(dly_ts_id,
+                             DELAYED_TRX_OP_STATE_STOPPED,
+                             DELAYED_TRX_OP_STATE_PENDING))
         {
-            assert(false);
-            break;
+            *p_dly_ts_id = dly_ts_id;
+            return true;
         }
     }
+
+    return false;
 }
 
 /**
- * Start delayed operation.
+ * Start delayed operation in a claimed slot.
  *
- * @param[in]  t0      Base time of the timestamp of the timeslot start [us].
- * @param[in]  dt      Time delta between @p t0 and the timestamp of the timeslot start [us].
- * @param[in]  length  Requested radio timeslot length [us].
- * @param[in]  dly_ts  Delayed timeslot ID.
+ * @param[in]  t0         Base time of the timestamp of the timeslot start [us].
+ * @param[in]  dt         Time delta between @p t0 and the timestamp of the timeslot start [us].
+ * @param[in]  length     Requested radio timeslot length [us].
+ * @param[in]  dly_ts_id  Delayed timeslot ID of a slot in PENDING state.
  */
 static bool dly_op_request(uint32_t         t0,
                            uint32_t         dt,
@@ -203,10 +480,6 @@ static bool dly_op_request(uint32_t         t0,
 {
     bool result;
 
-    // Set PENDING state before timeslot request, in case timeslot starts
-    // immediatly and interrupts current function execution.
-    dly_op_state_set(dly_ts_id, DELAYED_TRX_OP_STATE_STOPPED, DELAYED_TRX_OP_STATE_PENDING);
-
     result = nrf_802154_rsch_delayed_timeslot_request(t0,
                                                       dt,
                                                       length,
@@ -221,49 +494,125 @@ static bool dly_op_request(uint32_t         t0,
     return result;
 }
 
+/**
+ * Get time delta between the base time and the start of the timeslot of a receive window.
+ *
+ * @param[in]  dt  Time delta between the base time and the receive window start [us].
+ *
+ * @return  Time delta between the base time and the timeslot start [us].
+ */
+static inline uint32_t rx_timeslot_dt_get(uint32_t dt)
+{
+    return dt - setup_time_get(&m_rx_setup_time, RX_SETUP_TIME) - RX_RAMP_UP_TIME;
+}
+
+/**
+ * Request the timeslot of the next window of a periodic delayed RX operation.
+ *
+ * Each window is placed one period after the previous one, counting from the requested base time
+ * and not from the moment the previous window ended, so the schedule does not drift. Windows that
+ * can no longer be started on time are skipped.
+ *
+ * @param[in]  dly_ts_id  Delayed timeslot ID of an RX slot in PENDING state.
+ *
+ * @retval true   The next receive window is scheduled.
+ * @retval false  There are no more receive windows to schedule. The slot is stopped.
+ */
+static bool rx_next_window_request(rsch_dly_ts_id_t dly_ts_id)
+{
+    uint32_t rx_idx          = dly_rx_idx_get(dly_ts_id);
+    uint32_t timeslot_length = m_rx_timeout[rx_idx] +
+                               nrf_802154_rx_duration_get(MAX_PACKET_SIZE, true);
+
+    while (m_rx_windows_left[rx_idx] != 0)
+    {
+        if (m_rx_windows_left[rx_idx] != RX_WINDOWS_UNLIMITED)
+        {
+            m_rx_windows_left[rx_idx]--;
+        }
+
+        m_rx_t0[rx_idx]           += m_rx_period[rx_idx];
+        m_rx_ts_dt[rx_idx]         = rx_timeslot_dt_get(m_rx_dt[rx_idx]);
+        m_timeout_timer[rx_idx].dt = m_rx_timeout[rx_idx] + RX_RAMP_UP_TIME;
+
+        if (nrf_802154_rsch_delayed_timeslot_request(m_rx_t0[rx_idx],
+                                                     m_rx_ts_dt[rx_idx],
+                                                     timeslot_length,
+                                                     RSCH_PRIO_MAX,
+                                                     dly_ts_id))
+        {
+            return true;
+        }
+    }
+
+    dly_op_state_set(dly_ts_id, DELAYED_TRX_OP_STATE_PENDING, DELAYED_TRX_OP_STATE_STOPPED);
+
+    return false;
+}
+
 /**
  * Notify MAC layer that no frame was received before timeout.
  *
- * @param[in]  p_context  Not used.
+ * @param[in]  p_context  Delayed timeslot ID of the RX slot which timed out.
  */
 static void notify_rx_timeout(void * p_context)
 {
-    (void)p_context;
+    rsch_dly_ts_id_t dly_ts_id = (rsch_dly_ts_id_t)(uint32_t)p_context;
+    uint32_t         rx_idx    = dly_rx_idx_get(dly_ts_id);
 
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_DTRX_RX_TIMEOUT);
 
-    assert(dly_op_state_get(RSCH_DLY_RX) != DELAYED_TRX_OP_STATE_PENDING);
+    assert(dly_op_state_get(dly_ts_id) != DELAYED_TRX_OP_STATE_PENDING);
 
-    if (dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_ONGOING)
+    if (dly_op_state_get(dly_ts_id) == DELAYED_TRX_OP_STATE_ONGOING)
     {
         uint32_t now           = nrf_802154_timer_sched_time_get();
-        uint32_t sof_timestamp = m_dly_rx_frame.sof_timestamp;
+        uint32_t sof_timestamp = m_dly_rx_frame[rx_idx].sof_timestamp;
 
         // Make sure that the timestamp has been latched safely. If frame reception preempts the code
         // after executing this line, the RX window will not be extended.
         __DMB();
-        uint8_t  psdu_length   = m_dly_rx_frame.psdu_length;
-        bool     ack_requested = m_dly_rx_frame.ack_requested;
+        uint8_t  psdu_length   = m_dly_rx_frame[rx_idx].psdu_length;
+        bool     ack_requested = m_dly_rx_frame[rx_idx].ack_requested;
         uint32_t frame_length  = nrf_802154_rx_duration_get(psdu_length, ack_requested);
 
         if (nrf_802154_timer_sched_time_is_in_future(now, sof_timestamp, frame_length))
         {
             // @TODO protect against infinite extensions - allow only one timer extension
-            m_timeout_timer.t0 = sof_timestamp;
-            m_timeout_timer.dt = frame_length;
+            m_timeout_timer[rx_idx].t0 = sof_timestamp;
+            m_timeout_timer[rx_idx].dt = frame_length;
 
-            nrf_802154_timer_sched_add(&m_timeout_timer, true);
+            nrf_802154_timer_sched_add(&m_timeout_timer[rx_idx], true);
+        }
+        else if (m_rx_windows_left[rx_idx] != 0)
+        {
+            if (dly_op_state_cas(dly_ts_id,
+                                 DELAYED_TRX_OP_STATE_ONGOING,
+                                 DELAYED_TRX_OP_STATE_PENDING))
+            {
+#if NRF_802154_DELAYED_TRX_PERIODIC_RX_SLEEP_ENABLED
+                // Radio is not needed until the next receive window.
+                (void)nrf_802154_request_sleep(NRF_802154_TERM_NONE);
+#endif // NRF_802154_DELAYED_TRX_PERIODIC_RX_SLEEP_ENABLED
+
+                if (!rx_next_window_request(dly_ts_id))
+                {
+                    nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_TIMEOUT);
+                }
+            }
         }
         else
         {
-            if (dly_rx_state_set(DELAYED_TRX_OP_STATE_ONGOING, DELAYED_TRX_OP_STATE_STOPPED))
+            if (dly_op_state_cas(dly_ts_id,
+                                 DELAYED_TRX_OP_STATE_ONGOING,
+                                 DELAYED_TRX_OP_STATE_STOPPED))
             {
                 nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_TIMEOUT);
             }
 
             // even if the set operation failed, the delayed RX state
             // should be set to STOPPED from other context anyway
-            assert(dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_STOPPED);
+            assert(dly_op_state_get(dly_ts_id) == DELAYED_TRX_OP_STATE_STOPPED);
         }
     }
 
@@ -277,16 +626,27 @@ static void notify_rx_timeout(void * p_context)
  */
 static void tx_timeslot_started_callback(bool result)
 {
-    (void)result;
+    rsch_dly_ts_id_t dly_ts_id = m_dly_ts_starting;
 
     // To avoid attaching to every possible transmit hook, in order to be able
     // to switch from ONGOING to STOPPED state, ONGOING state is not used at all
     // and state is changed to STOPPED right after transmit request.
-    m_dly_op_state[RSCH_DLY_TX] = DELAYED_TRX_OP_STATE_STOPPED;
+    m_dly_op_state[dly_ts_id] = DELAYED_TRX_OP_STATE_STOPPED;
+
+#if NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED
+    if (result)
+    {
+        setup_time_measure(&m_tx_setup_time,
+                           TX_SETUP_TIME,
+                           TX_SETUP_TIME_MARGIN,
+                           m_tx_ts_start[dly_tx_idx_get(dly_ts_id)]);
+    }
+#endif // NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED
 
     if (!result)
     {
-        nrf_802154_notify_transmit_failed(mp_tx_data, NRF_802154_TX_ERROR_TIMESLOT_DENIED);
+        nrf_802154_notify_transmit_failed(mp_tx_data[dly_tx_idx_get(dly_ts_id)],
+                                          NRF_802154_TX_ERROR_TIMESLOT_DENIED);
     }
 }
 
@@ -297,24 +657,41 @@ static void tx_timeslot_started_callback(bool result)
  */
 static void rx_timeslot_started_callback(bool result)
 {
+    rsch_dly_ts_id_t dly_ts_id = m_dly_ts_starting;
+    uint32_t         rx_idx    = dly_rx_idx_get(dly_ts_id);
+
     if (result)
     {
         uint32_t now;
 
-        dly_op_state_set(RSCH_DLY_RX, DELAYED_TRX_OP_STATE_PENDING, DELAYED_TRX_OP_STATE_ONGOING);
+#if NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED
+        setup_time_measure(&m_rx_setup_time,
+                           RX_SETUP_TIME,
+                           RX_SETUP_TIME_MARGIN,
+                           m_rx_t0[rx_idx] + m_rx_ts_dt[rx_idx]);
+#endif // NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED
+
+        dly_op_state_set(dly_ts_id, DELAYED_TRX_OP_STATE_PENDING, DELAYED_TRX_OP_STATE_ONGOING);
 
         now = nrf_802154_timer_sched_time_get();
 
-        m_timeout_timer.t0           = now;
-        m_dly_rx_frame.sof_timestamp = now;
-        m_dly_rx_frame.psdu_length   = 0;
-        m_dly_rx_frame.ack_requested = false;
+        m_timeout_timer[rx_idx].t0           = now;
+        m_dly_rx_frame[rx_idx].sof_timestamp = now;
+        m_dly_rx_frame[rx_idx].psdu_length   = 0;
+        m_dly_rx_frame[rx_idx].ack_requested = false;
 
-        nrf_802154_timer_sched_add(&m_timeout_timer, true);
+        nrf_802154_timer_sched_add(&m_timeout_timer[rx_idx], true);
+    }
+    else if (m_rx_windows_left[rx_idx] != 0)
+    {
+        if (!rx_next_window_request(dly_ts_id))
+        {
+            nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED);
+        }
     }
     else
     {
-        dly_op_state_set(RSCH_DLY_RX, DELAYED_TRX_OP_STATE_PENDING, DELAYED_TRX_OP_STATE_STOPPED);
+        dly_op_state_set(dly_ts_id, DELAYED_TRX_OP_STATE_PENDING, DELAYED_TRX_OP_STATE_STOPPED);
 
         nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED);
     }
@@ -322,20 +699,25 @@ static void rx_timeslot_started_callback(bool result)
 
 /**
  * Handle TX timeslot start.
+ *
+ * @param[in]  dly_ts_id  Delayed timeslot ID of the TX slot that started.
  */
-static void tx_timeslot_started_callout(void)
+static void tx_timeslot_started_callout(rsch_dly_ts_id_t dly_ts_id)
 {
-    bool result;
+    bool     result;
+    uint32_t tx_idx = dly_tx_idx_get(dly_ts_id);
+
+    m_dly_ts_starting = dly_ts_id;
 
-    nrf_802154_pib_channel_set(m_tx_channel);
+    nrf_802154_pib_channel_set(m_tx_channel[tx_idx]);
     result = nrf_802154_request_channel_update();
 
     if (result)
     {
         (void)nrf_802154_request_transmit(NRF_802154_TERM_802154,
                                           REQ_ORIG_DELAYED_TRX,
-                                          mp_tx_data,
-                                          m_tx_cca,
+                                          mp_tx_data[tx_idx],
+                                          m_tx_cca[tx_idx],
                                           true,
                                           tx_timeslot_started_callback);
     }
@@ -347,12 +729,16 @@ static void tx_timeslot_started_callout(void)
 
 /**
  * Handle RX timeslot start.
+ *
+ * @param[in]  dly_ts_id  Delayed timeslot ID of the RX slot that started.
  */
-static void rx_timeslot_started_callout(void)
+static void rx_timeslot_started_callout(rsch_dly_ts_id_t dly_ts_id)
 {
     bool result;
 
-    nrf_802154_pib_channel_set(m_rx_channel);
+    m_dly_ts_starting = dly_ts_id;
+
+    nrf_802154_pib_channel_set(m_rx_channel[dly_rx_idx_get(dly_ts_id)]);
     result = nrf_802154_request_channel_update();
 
     if (result)
@@ -374,15 +760,18 @@ bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
                                      uint32_t        dt,
                                      uint8_t         channel)
 {
-    bool     result;
-    uint16_t timeslot_length;
-    bool     ack;
+    bool             result;
+    uint16_t         timeslot_length;
+    bool             ack;
+    rsch_dly_ts_id_t dly_ts_id;
 
-    result = dly_op_state_get(RSCH_DLY_TX) == DELAYED_TRX_OP_STATE_STOPPED;
+    result = dly_tx_slot_claim(&dly_ts_id);
 
     if (result)
     {
-        dt -= TX_SETUP_TIME;
+        uint32_t tx_idx = dly_tx_idx_get(dly_ts_id);
+
+        dt -= setup_time_get(&m_tx_setup_time, TX_SETUP_TIME);
         dt -= TX_RAMP_UP_TIME;
 
         if (cca)
@@ -393,64 +782,109 @@ bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
         ack             = p_data[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT;
         timeslot_length = nrf_802154_tx_duration_get(p_data[0], cca, ack);
 
-        mp_tx_data   = p_data;
-        m_tx_cca     = cca;
-        m_tx_channel = channel;
+        mp_tx_data[tx_idx]    = p_data;
+        m_tx_cca[tx_idx]      = cca;
+        m_tx_channel[tx_idx]  = channel;
+        m_tx_ts_start[tx_idx] = t0 + dt;
 
-        result = dly_op_request(t0, dt, timeslot_length, RSCH_DLY_TX);
+        result = dly_op_request(t0, dt, timeslot_length, dly_ts_id);
     }
 
     return result;
 }
 
-bool nrf_802154_delayed_trx_receive(uint32_t t0,
-                                    uint32_t dt,
-                                    uint32_t timeout,
-                                    uint8_t  channel)
+/**
+ * Request a delayed RX operation consisting of one or more receive windows.
+ *
+ * @param[in]  t0       Base of delay time of the first window [us].
+ * @param[in]  dt       Delta of delay time of the first window from @p t0 [us].
+ * @param[in]  timeout  Length of each receive window [us].
+ * @param[in]  channel  Number of the channel on which the frames are to be received.
+ * @param[in]  period   Distance between starts of consecutive receive windows [us].
+ * @param[in]  windows  Number of receive windows after the first one, or @ref RX_WINDOWS_UNLIMITED.
+ */
+static bool rx_request(uint32_t t0,
+                       uint32_t dt,
+                       uint32_t timeout,
+                       uint8_t  channel,
+                       uint32_t period,
+                       uint32_t windows)
 {
-    bool     result;
-    uint16_t timeslot_length;
+    bool             result;
+    uint16_t         timeslot_length;
+    rsch_dly_ts_id_t dly_ts_id;
 
-    result = dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_STOPPED;
+    result = dly_rx_slot_claim(&dly_ts_id);
 
     if (result)
     {
-
-        dt -= RX_SETUP_TIME;
-        dt -= RX_RAMP_UP_TIME;
+        uint32_t rx_idx = dly_rx_idx_get(dly_ts_id);
 
         timeslot_length = timeout + nrf_802154_rx_duration_get(MAX_PACKET_SIZE, true);
 
-        m_timeout_timer.dt        = timeout + RX_RAMP_UP_TIME;
-        m_timeout_timer.callback  = notify_rx_timeout;
-        m_timeout_timer.p_context = NULL;
+        m_timeout_timer[rx_idx].dt        = timeout + RX_RAMP_UP_TIME;
+        m_timeout_timer[rx_idx].callback  = notify_rx_timeout;
+        m_timeout_timer[rx_idx].p_context = (void *)dly_ts_id;
 
-        m_rx_channel = channel;
+        m_rx_channel[rx_idx]      = channel;
+        m_rx_t0[rx_idx]           = t0;
+        m_rx_dt[rx_idx]           = dt;
+        m_rx_ts_dt[rx_idx]        = rx_timeslot_dt_get(dt);
+        m_rx_timeout[rx_idx]      = timeout;
+        m_rx_period[rx_idx]       = period;
+        m_rx_windows_left[rx_idx] = windows;
 
-        // remove timer in case it was left after abort operation
-        nrf_802154_timer_sched_remove(&m_timeout_timer, NULL);
-
-        result = dly_op_request(t0, dt, timeslot_length, RSCH_DLY_RX);
+        result = dly_op_request(t0, m_rx_ts_dt[rx_idx], timeslot_length, dly_ts_id);
     }
 
     return result;
 }
 
-static inline void timeslot_started_callout(rsch_dly_ts_id_t dly_ts_id)
+bool nrf_802154_delayed_trx_receive(uint32_t t0,
+                                    uint32_t dt,
+                                    uint32_t timeout,
+                                    uint8_t  channel)
+{
+    return rx_request(t0, dt, timeout, channel, 0, 0);
+}
+
+bool nrf_802154_delayed_trx_receive_periodic(uint32_t t0,
+                                             uint32_t period,
+                                             uint32_t timeout,
+                                             uint8_t  channel,
+                                             uint32_t count)
 {
-    switch (dly_ts_id)
+    uint32_t windows = (count == 0) ? RX_WINDOWS_UNLIMITED : count - 1;
+
+    if ((period == 0) || (period <= timeout))
     {
-        case RSCH_DLY_TX:
-            tx_timeslot_started_callout();
-            break;
+        return false;
+    }
 
-        case RSCH_DLY_RX:
-            rx_timeslot_started_callout();
-            break;
+    return rx_request(t0, period, timeout, channel, period, windows);
+}
 
-        default:
-            assert(false);
-            break;
+void nrf_802154_delayed_trx_tx_setup_time_get(nrf_802154_setup_time_t * p_data)
+{
+    setup_time_copy(&m_tx_setup_time, TX_SETUP_TIME, p_data);
+}
+
+void nrf_802154_delayed_trx_rx_setup_time_get(nrf_802154_setup_time_t * p_data)
+{
+    setup_time_copy(&m_rx_setup_time, RX_SETUP_TIME, p_data);
+}
+
+static inline void timeslot_started_callout(rsch_dly_ts_id_t dly_ts_id)
+{
+    assert(dly_ts_id < RSCH_DLY_TS_NUM);
+
+    if (dly_ts_is_tx(dly_ts_id))
+    {
+        tx_timeslot_started_callout(dly_ts_id);
+    }
+    else
+    {
+        rx_timeslot_started_callout(dly_ts_id);
     }
 }
 
@@ -473,27 +907,45 @@ void nrf_802154_rsch_delayed_timeslot_started(rsch_dly_ts_id_t dly_ts_id)
 
 bool nrf_802154_delayed_trx_transmit_cancel(void)
 {
-    bool result;
+    bool result = false;
+
+    for (uint32_t i = 0; i < NRF_802154_DELAYED_TRX_TX_SLOTS; i++)
+    {
+        rsch_dly_ts_id_t dly_ts_id = (rsch_dly_ts_id_t)(RSCH_DLY_TX + i);
+
+        if (nrf_802154_rsch_delayed_timeslot_cancel(dly_ts_id))
+        {
+            result = true;
+        }
 
-    result                      = nrf_802154_rsch_delayed_timeslot_cancel(RSCH_DLY_TX);
-    m_dly_op_state[RSCH_DLY_TX] = DELAYED_TRX_OP_STATE_STOPPED;
+        m_dly_op_state[dly_ts_id] = DELAYED_TRX_OP_STATE_STOPPED;
+    }
 
     return result;
 }
 
 bool nrf_802154_delayed_trx_receive_cancel(void)
 {
-    bool result;
+    bool result = false;
 
-    result = nrf_802154_rsch_delayed_timeslot_cancel(RSCH_DLY_RX);
+    for (uint32_t i = 0; i < NRF_802154_DELAYED_TRX_RX_SLOTS; i++)
+    {
+        rsch_dly_ts_id_t dly_ts_id = (rsch_dly_ts_id_t)(RSCH_DLY_RX + i);
+        bool             was_running;
+
+        m_rx_windows_left[i] = 0;
 
-    bool was_running;
+        if (nrf_802154_rsch_delayed_timeslot_cancel(dly_ts_id))
+        {
+            result = true;
+        }
 
-    nrf_802154_timer_sched_remove(&m_timeout_timer, &was_running);
+        nrf_802154_timer_sched_remove(&m_timeout_timer[i], &was_running);
 
-    m_dly_op_state[RSCH_DLY_RX] = DELAYED_TRX_OP_STATE_STOPPED;
+        m_dly_op_state[dly_ts_id] = DELAYED_TRX_OP_STATE_STOPPED;
 
-    result = result || was_running;
+        result = result || was_running;
+    }
 
     return result;
 }
@@ -506,22 +958,49 @@ bool nrf_802154_delayed_trx_abort(nrf_802154_term_t term_lvl, req_originator_t r
     {
         // Ignore if self-request.
     }
-    else if (dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_ONGOING)
+    else
     {
-        if (term_lvl >= NRF_802154_TERM_802154)
+        for (uint32_t i = 0; i < NRF_802154_DELAYED_TRX_RX_SLOTS; i++)
         {
-            if (dly_rx_state_set(DELAYED_TRX_OP_STATE_ONGOING, DELAYED_TRX_OP_STATE_STOPPED))
+            rsch_dly_ts_id_t dly_ts_id = (rsch_dly_ts_id_t)(RSCH_DLY_RX + i);
+
+            if (dly_op_state_get(dly_ts_id) != DELAYED_TRX_OP_STATE_ONGOING)
             {
-                nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_ABORTED);
+                continue;
             }
 
-            // even if the set operation failed, the delayed RX state
-            // should be set to STOPPED from other context anyway
-            assert(dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_STOPPED);
-        }
-        else
-        {
-            result = false;
+            if ((term_lvl >= NRF_802154_TERM_802154) && (m_rx_windows_left[i] != 0))
+            {
+                // Another operation takes over the radio, but the next windows are still expected.
+                if (dly_op_state_cas(dly_ts_id,
+                                     DELAYED_TRX_OP_STATE_ONGOING,
+                                     DELAYED_TRX_OP_STATE_PENDING))
+                {
+                    nrf_802154_timer_sched_remove(&m_timeout_timer[i], NULL);
+
+                    if (!rx_next_window_request(dly_ts_id))
+                    {
+                        nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_ABORTED);
+                    }
+                }
+            }
+            else if (term_lvl >= NRF_802154_TERM_802154)
+            {
+                if (dly_op_state_cas(dly_ts_id,
+                                     DELAYED_TRX_OP_STATE_ONGOING,
+                                     DELAYED_TRX_OP_STATE_STOPPED))
+                {
+                    nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_ABORTED);
+                }
+
+                // even if the set operation failed, the delayed RX state
+                // should be set to STOPPED from other context anyway
+                assert(dly_op_state_get(dly_ts_id) == DELAYED_TRX_OP_STATE_STOPPED);
+            }
+            else
+            {
+                result = false;
+            }
         }
     }
 
@@ -530,10 +1009,13 @@ bool nrf_802154_delayed_trx_abort(nrf_802154_term_t term_lvl, req_originator_t r
 
 void nrf_802154_delayed_trx_rx_started_hook(const uint8_t * p_frame)
 {
-    if (dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_ONGOING)
+    for (uint32_t i = 0; i < NRF_802154_DELAYED_TRX_RX_SLOTS; i++)
     {
-        m_dly_rx_frame.sof_timestamp = nrf_802154_timer_sched_time_get();
-        m_dly_rx_frame.psdu_length   = p_frame[PHR_OFFSET];
-        m_dly_rx_frame.ack_requested = nrf_802154_frame_parser_ar_bit_is_set(p_frame);
+        if (dly_op_state_get((rsch_dly_ts_id_t)(RSCH_DLY_RX + i)) == DELAYED_TRX_OP_STATE_ONGOING)
+        {
+            m_dly_rx_frame[i].sof_timestamp = nrf_802154_timer_sched_time_get();
+            m_dly_rx_frame[i].psdu_length   = p_frame[PHR_OFFSET];
+            m_dly_rx_frame[i].ack_requested = nrf_802154_frame_parser_ar_bit_is_set(p_frame);
+        }
     }
 }
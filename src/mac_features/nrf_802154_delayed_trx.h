@@ -63,6 +63,10 @@
  * @param[in]  t0       Base of delay time in microseconds.
  * @param[in]  dt       Delta of the delay time from @p t0 in microseconds.
  * @param[in]  channel  Number of the channel on which the frame is to be transmitted.
+ *
+ * @retval true   The transmission was scheduled in a free TX slot.
+ * @retval false  All @ref NRF_802154_DELAYED_TRX_TX_SLOTS slots are in use or the timeslot could
+ *                not be scheduled.
  */
 bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
                                      bool            cca,
@@ -71,7 +75,7 @@ bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
                                      uint8_t         channel);
 
 /**
- * @brief Cancels a transmission scheduled by a call to @ref nrf_802154_delayed_trx_transmit.
+ * @brief Cancels all transmissions scheduled by calls to @ref nrf_802154_delayed_trx_transmit.
  *
  * This function does not cancel transmission if the transmission is already ongoing.
  *
@@ -96,6 +100,10 @@ bool nrf_802154_delayed_trx_transmit_cancel(void);
  * @param[in]  dt       Delta of delay time from @p t0 in microseconds.
  * @param[in]  timeout  Reception timeout (counted from @p t0 + @p dt) in microseconds.
  * @param[in]  channel  Number of the channel on which the frame is to be received.
+ *
+ * @retval true   The reception was scheduled in a free RX slot.
+ * @retval false  All @ref NRF_802154_DELAYED_TRX_RX_SLOTS slots are in use or the timeslot could
+ *                not be scheduled.
  */
 bool nrf_802154_delayed_trx_receive(uint32_t t0,
                                     uint32_t dt,
@@ -103,7 +111,32 @@ bool nrf_802154_delayed_trx_receive(uint32_t t0,
                                     uint8_t  channel);
 
 /**
- * @brief Cancels a reception scheduled by a call to @ref nrf_802154_delayed_trx_receive.
+ * @brief Requests the reception of frames in periodic receive windows.
+ *
+ * The receive windows start at @p t0 + n * @p period, where n counts from 1 to @p count.
+ * The next window is scheduled by this module when the previous one ends. The radio is put to sleep
+ * between the windows only if @ref NRF_802154_DELAYED_TRX_PERIODIC_RX_SLEEP_ENABLED is set. Only
+ * the end of the last window is reported with the @ref nrf_802154_receive_failed function.
+ *
+ * @param[in]  t0       Base of delay time in microseconds.
+ * @param[in]  period   Distance between starts of consecutive receive windows in microseconds.
+ * @param[in]  timeout  Length of each receive window in microseconds.
+ * @param[in]  channel  Number of the channel on which the frames are to be received.
+ * @param[in]  count    Number of receive windows. If 0, windows are scheduled until cancelled.
+ *
+ * @retval true   The first receive window was scheduled in a free RX slot.
+ * @retval false  All @ref NRF_802154_DELAYED_TRX_RX_SLOTS slots are in use, @p period is not
+ *                longer than @p timeout, or the timeslot could not be scheduled.
+ */
+bool nrf_802154_delayed_trx_receive_periodic(uint32_t t0,
+                                             uint32_t period,
+                                             uint32_t timeout,
+                                             uint8_t  channel,
+                                             uint32_t count);
+
+/**
+ * @brief Cancels all receptions scheduled by calls to @ref nrf_802154_delayed_trx_receive and
+ *        @ref nrf_802154_delayed_trx_receive_periodic.
  *
  * After a call to this function, no reception timeout event will be notified.
  *
@@ -112,6 +145,20 @@ bool nrf_802154_delayed_trx_receive(uint32_t t0,
  */
 bool nrf_802154_delayed_trx_receive_cancel(void);
 
+/**
+ * @brief Gets the setup time measurements of delayed transmissions.
+ *
+ * @param[out]  p_data  Pointer to the structure to be filled with the measurements.
+ */
+void nrf_802154_delayed_trx_tx_setup_time_get(nrf_802154_setup_time_t * p_data);
+
+/**
+ * @brief Gets the setup time measurements of delayed receptions.
+ *
+ * @param[out]  p_data  Pointer to the structure to be filled with the measurements.
+ */
+void nrf_802154_delayed_trx_rx_setup_time_get(nrf_802154_setup_time_t * p_data);
+
 /**
  * @brief Aborts an ongoing delayed reception procedure.
  *
@@ -45,38 +45,148 @@
 #include "nrf_802154_const.h"
 
 /***************************************************************************************************
- * @section Helper functions
+ * @section MAC header layout table
  **************************************************************************************************/
 
-// Version
-static uint8_t frame_version_get(const uint8_t * p_frame)
+#define MHR_LAYOUT_2006        0 ///< Frame version 0 or 1.
+#define MHR_LAYOUT_2015        1 ///< Frame version 2 with the sequence number present.
+#define MHR_LAYOUT_2015_NO_DSN 2 ///< Frame version 2 with the sequence number suppressed.
+#define MHR_LAYOUTS_NUM        3 ///< Number of MAC header layouts.
+
+#define ADDR_MODES_NUM         4 ///< Number of values of an addressing mode field.
+#define DEST_ADDR_TYPE_SHIFT   2 ///< Position of the destination addressing mode in the FCF byte.
+#define SRC_ADDR_TYPE_SHIFT    6 ///< Position of the source addressing mode in the FCF byte.
+
+#define INVALID                NRF_802154_FRAME_PARSER_INVALID_OFFSET
+
+// Rules used to generate the layout table. The arguments are: layout (l), PAN ID compression
+// bit (c), source addressing mode (s) and destination addressing mode (d). The addressing modes
+// are the values of the FCF fields shifted to the range 0 - 3, where 1 is reserved.
+#define ADDR_SIZE(mode)                                                                            \
+    ((mode) == 0 ? 0 :                                                                             \
+     (mode) == (DEST_ADDR_TYPE_SHORT >> DEST_ADDR_TYPE_SHIFT) ? SHORT_ADDRESS_SIZE :               \
+     (mode) == (DEST_ADDR_TYPE_EXTENDED >> DEST_ADDR_TYPE_SHIFT) ? EXTENDED_ADDRESS_SIZE : INVALID)
+
+#define ADDR_IS_EXTENDED(mode) ((mode) == (DEST_ADDR_TYPE_EXTENDED >> DEST_ADDR_TYPE_SHIFT))
+
+#define ADDRESSING_OFFSET(l) \
+    (PHR_SIZE + FCF_SIZE + ((l) == MHR_LAYOUT_2015_NO_DSN ? 0 : DSN_SIZE))
+
+// IEEE 802.15.4-2015: Table 7-2 PAN ID Compression field value for frame version 0b10.
+#define DST_PANID_IS_PRESENT(l, c, s, d)                          \
+    ((l) == MHR_LAYOUT_2006 ? ((d) != 0) :                        \
+     (ADDR_IS_EXTENDED(d) && ADDR_IS_EXTENDED(s)) ? !(c) :        \
+     (((s) != 0) && ((d) != 0)) ? 1 :                             \
+     ((s) != 0) ? 0 :                                             \
+     ((d) != 0) ? !(c) : (c))
+
+#define SRC_PANID_IS_PRESENT(l, c, s, d)                          \
+    ((l) == MHR_LAYOUT_2006 ? (((s) != 0) && !(c)) :              \
+     (ADDR_IS_EXTENDED(d) && ADDR_IS_EXTENDED(s)) ? 0 :           \
+     ((s) != 0) ? !(c) : 0)
+
+#define DST_PANID_OFFSET(l, c, s, d) \
+    (DST_PANID_IS_PRESENT(l, c, s, d) ? ADDRESSING_OFFSET(l) : 0)
+
+#define DST_ADDR_OFFSET(l, c, s, d)                                                         \
+    ((d) == 0 ? 0 :                                                                         \
+     ADDRESSING_OFFSET(l) + (DST_PANID_IS_PRESENT(l, c, s, d) ? PAN_ID_SIZE : 0))
+
+#define DST_ADDR_END_OFFSET(l, c, s, d)                                                     \
+    (ADDR_SIZE(d) == INVALID ? INVALID :                                                    \
+     ADDRESSING_OFFSET(l) + (DST_PANID_IS_PRESENT(l, c, s, d) ? PAN_ID_SIZE : 0) +          \
+     ADDR_SIZE(d))
+
+#define SRC_PANID_OFFSET(l, c, s, d)                                                        \
+    (SRC_PANID_IS_PRESENT(l, c, s, d) ? DST_ADDR_END_OFFSET(l, c, s, d) :                   \
+     DST_PANID_OFFSET(l, c, s, d))
+
+#define SRC_ADDR_OFFSET(l, c, s, d)                                                         \
+    ((s) == 0 ? 0 :                                                                         \
+     DST_ADDR_END_OFFSET(l, c, s, d) == INVALID ? INVALID :                                 \
+     DST_ADDR_END_OFFSET(l, c, s, d) + (SRC_PANID_IS_PRESENT(l, c, s, d) ? PAN_ID_SIZE : 0))
+
+#define ADDRESSING_END_OFFSET(l, c, s, d)                                                   \
+    ((DST_ADDR_END_OFFSET(l, c, s, d) == INVALID) || (ADDR_SIZE(s) == INVALID) ? INVALID :  \
+     DST_ADDR_END_OFFSET(l, c, s, d) + (SRC_PANID_IS_PRESENT(l, c, s, d) ? PAN_ID_SIZE : 0) + \
+     ADDR_SIZE(s))
+
+#define MHR_LAYOUT(l, c, s, d)                \
+    {                                         \
+        DST_PANID_OFFSET(l, c, s, d),         \
+        DST_ADDR_OFFSET(l, c, s, d),          \
+        DST_ADDR_END_OFFSET(l, c, s, d),      \
+        SRC_PANID_OFFSET(l, c, s, d),         \
+        SRC_ADDR_OFFSET(l, c, s, d),          \
+        ADDRESSING_END_OFFSET(l, c, s, d),    \
+    }
+
+#define MHR_LAYOUTS_DST(l, c, s) \
+    MHR_LAYOUT(l, c, s, 0), MHR_LAYOUT(l, c, s, 1), MHR_LAYOUT(l, c, s, 2), MHR_LAYOUT(l, c, s, 3)
+
+#define MHR_LAYOUTS_SRC(l, c)                         \
+    MHR_LAYOUTS_DST(l, c, 0), MHR_LAYOUTS_DST(l, c, 1), \
+    MHR_LAYOUTS_DST(l, c, 2), MHR_LAYOUTS_DST(l, c, 3)
+
+#define MHR_LAYOUTS(l) MHR_LAYOUTS_SRC(l, 0), MHR_LAYOUTS_SRC(l, 1)
+
+/**
+ * @brief Offsets of the addressing fields of a MAC header.
+ *
+ * Offsets are counted from the beginning of the buffer containing PHR. Offset 0 indicates that
+ * the field is not present and @ref NRF_802154_FRAME_PARSER_INVALID_OFFSET indicates that the
+ * field cannot be located due to a reserved addressing mode.
+ */
+typedef struct
+{
+    uint8_t dst_panid_offset;      ///< Offset of the destination PAN ID.
+    uint8_t dst_addr_offset;       ///< Offset of the destination address.
+    uint8_t dst_addr_end_offset;   ///< Offset of the first byte following the destination fields.
+    uint8_t src_panid_offset;      ///< Offset of the source PAN ID, or of the compressed one.
+    uint8_t src_addr_offset;       ///< Offset of the source address.
+    uint8_t addressing_end_offset; ///< Offset of the first byte following the addressing fields.
+} mhr_layout_t;
+
+/**
+ * @brief Layouts of the MAC header for all combinations of the FCF fields that affect it.
+ *
+ * The table is generated at compile time and indexed by @ref mhr_layout_get, so that all offsets
+ * of the addressing fields are obtained with a single lookup instead of evaluating the addressing
+ * rules of the frame version for every field.
+ */
+static const mhr_layout_t m_mhr_layouts[MHR_LAYOUTS_NUM * 2 * ADDR_MODES_NUM * ADDR_MODES_NUM] =
 {
-    return p_frame[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK;
-}
+    MHR_LAYOUTS(MHR_LAYOUT_2006),
+    MHR_LAYOUTS(MHR_LAYOUT_2015),
+    MHR_LAYOUTS(MHR_LAYOUT_2015_NO_DSN),
+};
 
-// Addressing
+/***************************************************************************************************
+ * @section Helper functions
+ **************************************************************************************************/
 
-static uint8_t addressing_offset_get(const uint8_t * p_frame)
+static const mhr_layout_t * mhr_layout_get(const uint8_t * p_frame)
 {
-    if ((frame_version_get(p_frame) >= FRAME_VERSION_2) &&
-        nrf_802154_frame_parser_dsn_suppress_bit_is_set(p_frame))
+    uint8_t fcf   = p_frame[FRAME_VERSION_OFFSET];
+    uint8_t compr = (p_frame[PAN_ID_COMPR_OFFSET] & PAN_ID_COMPR_MASK) ? 1 : 0;
+    uint8_t src   = (fcf & SRC_ADDR_TYPE_MASK) >> SRC_ADDR_TYPE_SHIFT;
+    uint8_t dst   = (fcf & DEST_ADDR_TYPE_MASK) >> DEST_ADDR_TYPE_SHIFT;
+    uint8_t layout;
+
+    if ((fcf & FRAME_VERSION_MASK) < FRAME_VERSION_2)
     {
-        return PHR_SIZE + FCF_SIZE;
+        layout = MHR_LAYOUT_2006;
+    }
+    else if (fcf & DSN_SUPPRESS_BIT)
+    {
+        layout = MHR_LAYOUT_2015_NO_DSN;
     }
     else
     {
-        return PHR_SIZE + FCF_SIZE + DSN_SIZE;
+        layout = MHR_LAYOUT_2015;
     }
-}
 
-static bool src_addr_is_present(const uint8_t * p_frame)
-{
-    return (p_frame[SRC_ADDR_TYPE_OFFSET] & SRC_ADDR_TYPE_MASK) != SRC_ADDR_TYPE_NONE;
-}
-
-static bool dst_addr_is_present(const uint8_t * p_frame)
-{
-    return (p_frame[DEST_ADDR_TYPE_OFFSET] & DEST_ADDR_TYPE_MASK) != DEST_ADDR_TYPE_NONE;
+    return &m_mhr_layouts[((layout * 2 + compr) * ADDR_MODES_NUM + src) * ADDR_MODES_NUM + dst];
 }
 
 static uint8_t src_addr_size_get(const uint8_t * p_frame)
@@ -115,96 +225,6 @@ static uint8_t dst_addr_size_get(const uint8_t * p_frame)
     }
 }
 
-// PAN ID
-static bool dst_panid_is_present(const uint8_t * p_frame)
-{
-    bool panid_compression = (p_frame[PAN_ID_COMPR_OFFSET] & PAN_ID_COMPR_MASK) ? true : false;
-
-    switch (frame_version_get(p_frame))
-    {
-        case FRAME_VERSION_0:
-        case FRAME_VERSION_1:
-            if (!dst_addr_is_present(p_frame))
-            {
-                return false;
-            }
-
-            return true;
-
-        case FRAME_VERSION_2:
-        default:
-            if (nrf_802154_frame_parser_dst_addr_is_extended(p_frame) &&
-                nrf_802154_frame_parser_src_addr_is_extended(p_frame))
-            {
-                return panid_compression ? false : true;
-            }
-
-            if (src_addr_is_present(p_frame) && dst_addr_is_present(p_frame))
-            {
-                return true;
-            }
-
-            if (src_addr_is_present(p_frame))
-            {
-                return false;
-            }
-
-            if (dst_addr_is_present(p_frame))
-            {
-                return panid_compression ? false : true;
-            }
-
-            return panid_compression ? true : false;
-    }
-}
-
-static bool src_panid_is_present(const uint8_t * p_frame)
-{
-    bool panid_compression = (p_frame[PAN_ID_COMPR_OFFSET] & PAN_ID_COMPR_MASK) ? true : false;
-
-    switch (frame_version_get(p_frame))
-    {
-        case FRAME_VERSION_0:
-        case FRAME_VERSION_1:
-            if (!src_addr_is_present(p_frame))
-            {
-                return false;
-            }
-
-            return panid_compression ? false : true;
-
-        case FRAME_VERSION_2:
-        default:
-            if (nrf_802154_frame_parser_dst_addr_is_extended(p_frame) &&
-                nrf_802154_frame_parser_src_addr_is_extended(p_frame))
-            {
-                return false;
-            }
-
-            if (src_addr_is_present(p_frame) && dst_addr_is_present(p_frame))
-            {
-                return panid_compression ? false : true;
-            }
-
-            if (src_addr_is_present(p_frame))
-            {
-                return panid_compression ? false : true;
-            }
-
-            if (dst_addr_is_present(p_frame))
-            {
-                return false;
-            }
-
-            return false;
-    }
-}
-
-static bool src_panid_is_compressed(const uint8_t * p_frame)
-{
-    return dst_panid_is_present(p_frame) && !src_panid_is_present(p_frame);
-}
-
 // Security
 static bool security_is_enabled(const uint8_t * p_frame)
 {
@@ -213,49 +233,7 @@ static bool security_is_enabled(const uint8_t * p_frame)
 
 static uint8_t security_offset_get(const uint8_t * p_frame)
 {
-    uint8_t dst_addr_offset  = nrf_802154_frame_parser_dst_addr_offset_get(p_frame);
-    uint8_t dst_panid_offset = nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-    uint8_t dst_addr_size    = dst_addr_size_get(p_frame);
-    uint8_t src_addr_offset  = nrf_802154_frame_parser_src_addr_offset_get(p_frame);
-    uint8_t src_panid_offset = nrf_802154_frame_parser_src_panid_offset_get(p_frame);
-    uint8_t src_addr_size    = src_addr_size_get(p_frame);
-
-    if (src_addr_is_present(p_frame))
-    {
-        if ((src_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET) ||
-            (src_addr_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET))
-        {
-            return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-        }
-
-        return src_addr_offset + src_addr_size;
-    }
-    else if (src_panid_is_present(p_frame))
-    {
-        if (src_panid_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-        {
-            return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-        }
-
-        return src_panid_offset + PAN_ID_SIZE;
-    }
-    else if (dst_addr_offset)
-    {
-        if (dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-        {
-            return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-        }
-
-        return dst_addr_offset + dst_addr_size;
-    }
-    else if (dst_panid_offset)
-    {
-        return dst_panid_offset + PAN_ID_SIZE;
-    }
-    else
-    {
-        return addressing_offset_get(p_frame);
-    }
+    return mhr_layout_get(p_frame)->addressing_end_offset;
 }
 
 static uint8_t key_id_size_get(const uint8_t * p_frame)
@@ -343,127 +321,27 @@ bool nrf_802154_frame_parser_ar_bit_is_set(const uint8_t * p_frame)
 
 uint8_t nrf_802154_frame_parser_dst_panid_offset_get(const uint8_t * p_frame)
 {
-    if (dst_panid_is_present(p_frame))
-    {
-        return addressing_offset_get(p_frame);
-    }
-    else
-    {
-        return 0;
-    }
+    return mhr_layout_get(p_frame)->dst_panid_offset;
 }
 
 uint8_t nrf_802154_frame_parser_dst_addr_offset_get(const uint8_t * p_frame)
 {
-    uint8_t dst_panid_offset = nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-
-    if (dst_addr_is_present(p_frame))
-    {
-        return 0 ==
-               dst_panid_offset ? addressing_offset_get(p_frame) : dst_panid_offset + PAN_ID_SIZE;
-    }
-    else
-    {
-        return 0;
-    }
+    return mhr_layout_get(p_frame)->dst_addr_offset;
 }
 
 uint8_t nrf_802154_frame_parser_dst_addr_end_offset_get(const uint8_t * p_frame)
 {
-    uint8_t offset        = addressing_offset_get(p_frame);
-    uint8_t dst_addr_size = dst_addr_size_get(p_frame);
-
-    if (dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-    {
-        return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-    }
-
-    if (dst_panid_is_present(p_frame))
-    {
-        offset += PAN_ID_SIZE;
-    }
-
-    offset += dst_addr_size;
-
-    return offset;
+    return mhr_layout_get(p_frame)->dst_addr_end_offset;
 }
 
 uint8_t nrf_802154_frame_parser_src_panid_offset_get(const uint8_t * p_frame)
 {
-    uint8_t dst_addr_offset  = nrf_802154_frame_parser_dst_addr_offset_get(p_frame);
-    uint8_t dst_panid_offset = nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-    uint8_t dst_addr_size    = dst_addr_size_get(p_frame);
-
-    if (src_panid_is_present(p_frame))
-    {
-        if (dst_addr_offset)
-        {
-            if (dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-            {
-                return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-            }
-
-            return dst_addr_offset + dst_addr_size;
-        }
-        else if (dst_panid_offset)
-        {
-            return dst_panid_offset + PAN_ID_SIZE;
-        }
-        else
-        {
-            return addressing_offset_get(p_frame);
-        }
-    }
-    else if (src_panid_is_compressed(p_frame))
-    {
-        return nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-    }
-    else
-    {
-        return 0;
-    }
+    return mhr_layout_get(p_frame)->src_panid_offset;
 }
 
 uint8_t nrf_802154_frame_parser_src_addr_offset_get(const uint8_t * p_frame)
 {
-    uint8_t dst_addr_offset  = nrf_802154_frame_parser_dst_addr_offset_get(p_frame);
-    uint8_t dst_panid_offset = nrf_802154_frame_parser_dst_panid_offset_get(p_frame);
-    uint8_t dst_addr_size    = dst_addr_size_get(p_frame);
-    uint8_t src_panid_offset = nrf_802154_frame_parser_src_panid_offset_get(p_frame);
-
-    if (src_addr_is_present(p_frame))
-    {
-        if (src_panid_is_present(p_frame))
-        {
-            if (src_panid_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-            {
-                return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-            }
-
-            return src_panid_offset + PAN_ID_SIZE;
-        }
-        else if (dst_addr_offset)
-        {
-            if (dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-            {
-                return NRF_802154_FRAME_PARSER_INVALID_OFFSET;
-            }
-
-            return dst_addr_offset + dst_addr_size;
-        }
-        else if (dst_panid_offset)
-        {
-            return dst_panid_offset + PAN_ID_SIZE;
-        }
-        else
-        {
-            return addressing_offset_get(p_frame);
-        }
-    }
-    else
-    {
-        return 0;
-    }
+    return mhr_layout_get(p_frame)->src_addr_offset;
 }
 
 uint8_t nrf_802154_frame_parser_addressing_end_offset_get(const uint8_t * p_frame)
@@ -576,73 +454,29 @@ const uint8_t * nrf_802154_frame_parser_src_addr_get(const uint8_t * p_frame,
 bool nrf_802154_frame_parser_mhr_parse(const uint8_t                      * p_frame,
                                        nrf_802154_frame_parser_mhr_data_t * p_fields)
 {
-    uint8_t offset               = addressing_offset_get(p_frame);
-    bool    is_dst_panid_present = dst_panid_is_present(p_frame);
-    bool    is_src_panid_present = src_panid_is_present(p_frame);
+    const mhr_layout_t * p_layout = mhr_layout_get(p_frame);
 
-    if (is_dst_panid_present)
+    if (p_layout->addressing_end_offset == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
     {
-        p_fields->p_dst_panid = &p_frame[offset];
-        offset               += PAN_ID_SIZE;
+        return false;
     }
-    else
-    {
-        p_fields->p_dst_panid = NULL;
-    }
-
-    if (dst_addr_is_present(p_frame))
-    {
-        p_fields->p_dst_addr    = &p_frame[offset];
-        p_fields->dst_addr_size = dst_addr_size_get(p_frame);
-        offset                 += (p_fields->dst_addr_size);
 
-        if (p_fields->dst_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-        {
-            return false;
-        }
-    }
-    else
-    {
-        p_fields->p_dst_addr    = NULL;
-        p_fields->dst_addr_size = 0;
-    }
-
-    if (is_src_panid_present)
-    {
-        p_fields->p_src_panid = &p_frame[offset];
-        offset               += PAN_ID_SIZE;
-    }
-    else if (is_dst_panid_present)
-    {
-        p_fields->p_src_panid = p_fields->p_dst_panid;
-    }
-    else
-    {
-        p_fields->p_src_panid = NULL;
-    }
-
-    if (src_addr_is_present(p_frame))
-    {
-        p_fields->p_src_addr    = &p_frame[offset];
-        p_fields->src_addr_size = src_addr_size_get(p_frame);
-        offset                 += (p_fields->src_addr_size);
-
-        if (p_fields->src_addr_size == NRF_802154_FRAME_PARSER_INVALID_OFFSET)
-        {
-            return false;
-        }
-    }
-    else
-    {
-        p_fields->p_src_addr    = NULL;
-        p_fields->src_addr_size = 0;
-    }
+    p_fields->p_dst_panid   = p_layout->dst_panid_offset ? &p_frame[p_layout->dst_panid_offset] :
+                              NULL;
+    p_fields->p_dst_addr    = p_layout->dst_addr_offset ? &p_frame[p_layout->dst_addr_offset] :
+                              NULL;
+    p_fields->dst_addr_size = dst_addr_size_get(p_frame);
+    p_fields->p_src_panid   = p_layout->src_panid_offset ? &p_frame[p_layout->src_panid_offset] :
+                              NULL;
+    p_fields->p_src_addr    = p_layout->src_addr_offset ? &p_frame[p_layout->src_addr_offset] :
+                              NULL;
+    p_fields->src_addr_size = src_addr_size_get(p_frame);
 
-    p_fields->addressing_end_offset = offset;
+    p_fields->addressing_end_offset = p_layout->addressing_end_offset;
 
     if (security_is_enabled(p_frame))
     {
-        p_fields->p_sec_ctrl = &p_frame[offset];
+        p_fields->p_sec_ctrl = &p_frame[p_layout->addressing_end_offset];
         // TODO increment offset...
     }
     else
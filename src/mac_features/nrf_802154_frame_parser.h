@@ -39,22 +39,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-#define NRF_802154_FRAME_PARSER_INVALID_OFFSET 0xff
+#include "nrf_802154_types.h"
 
-/**
- * @biref Structure that contains pointers to parts of MHR and details of MHR structure.
- */
-typedef struct
-{
-    const uint8_t * p_dst_panid;           ///< Pointer to the destination PAN ID field, or NULL if missing.
-    const uint8_t * p_dst_addr;            ///< Pointer to the destination address field, or NULL if missing.
-    const uint8_t * p_src_panid;           ///< Pointer to the source PAN ID field, or NULL if missing.
-    const uint8_t * p_src_addr;            ///< Pointer to the source address field, or NULL if missing.
-    const uint8_t * p_sec_ctrl;            ///< Pointer to the security control field, or NULL if missing.
-    uint8_t         dst_addr_size;         ///< Size of the destination address field.
-    uint8_t         src_addr_size;         ///< Size of the source address field.
-    uint8_t         addressing_end_offset; ///< Offset of the first byte following addressing fields.
-} nrf_802154_frame_parser_mhr_data_t;
+#define NRF_802154_FRAME_PARSER_INVALID_OFFSET 0xff
 
 /**
  * @brief Determines if the destination address is extended.
@@ -56,6 +56,103 @@ static nrf_802154_timer_t m_timer;
 static volatile bool      m_procedure_is_active;
 static const uint8_t    * mp_frame;
 
+#if NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+
+/** Delays of ACK frames of a single type. */
+typedef struct
+{
+    nrf_802154_ack_delay_t data;           ///< Measured delays.
+    uint32_t               window_max;     ///< Longest delay measured in the current window [us].
+    uint32_t               prev_max;       ///< Longest delay measured in the previous window [us].
+    uint32_t               window_samples; ///< Number of delays measured in the current window.
+} ack_delay_t;
+
+static ack_delay_t   m_imm_ack_delay; ///< Delays of Imm-Acks.
+static ack_delay_t   m_enh_ack_delay; ///< Delays of Enh-Acks.
+static ack_delay_t * mp_ack_delay;    ///< Delays of the ACK type expected for the transmitted frame.
+static uint32_t      m_tx_end_time;   ///< Time at which the transmitted frame ends [us].
+static uint32_t      m_timeouts;      ///< Number of transmissions that ended with ACK timeout.
+
+/**
+ * @brief Get time in which the ACK of given type must start based on the measured delays.
+ *
+ * @param[in]  p_ack_delay   Delays of the ACK type.
+ * @param[in]  default_time  Time used if no delay was measured yet [us].
+ *
+ * @return Time in which the ACK must start after the end of the transmitted frame [us].
+ */
+static uint32_t ack_delay_timeout_get(const ack_delay_t * p_ack_delay, uint32_t default_time)
+{
+    uint32_t max;
+
+    if (p_ack_delay->data.samples == 0)
+    {
+        return default_time;
+    }
+
+    max = (p_ack_delay->window_max > p_ack_delay->prev_max) ?
+          p_ack_delay->window_max : p_ack_delay->prev_max;
+
+    if (max + NRF_802154_ACK_TIMEOUT_ADAPTIVE_MARGIN < default_time)
+    {
+        return max + NRF_802154_ACK_TIMEOUT_ADAPTIVE_MARGIN;
+    }
+
+    return default_time;
+}
+
+/**
+ * @brief Store delay of the ACK frame that has just started.
+ *
+ * @param[inout]  p_ack_delay  Delays of the received ACK type.
+ * @param[in]     delay        Time between the end of the transmitted frame and the ACK start [us].
+ */
+static void ack_delay_measure(ack_delay_t * p_ack_delay, uint32_t delay)
+{
+    if ((p_ack_delay->data.samples == 0) || (delay < p_ack_delay->data.min))
+    {
+        p_ack_delay->data.min = delay;
+    }
+
+    if (delay > p_ack_delay->data.max)
+    {
+        p_ack_delay->data.max = delay;
+    }
+
+    if (delay > p_ack_delay->window_max)
+    {
+        p_ack_delay->window_max = delay;
+    }
+
+    p_ack_delay->data.samples++;
+    p_ack_delay->window_samples++;
+
+    if (p_ack_delay->window_samples >= NRF_802154_ACK_TIMEOUT_ADAPTIVE_WINDOW)
+    {
+        p_ack_delay->prev_max       = p_ack_delay->window_max;
+        p_ack_delay->window_max     = 0;
+        p_ack_delay->window_samples = 0;
+    }
+}
+
+#endif // NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+
+/**
+ * @brief Get time in which the ACK must start after the end of the transmitted frame.
+ *
+ * @return Time in which the ACK must start [us].
+ */
+static uint32_t ack_wait_time_get(void)
+{
+    uint32_t wait_time = m_timeout + IMM_ACK_DURATION;
+
+#if NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+    wait_time = ack_delay_timeout_get(mp_ack_delay, wait_time);
+#endif // NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+
+    return wait_time;
+}
+
 static void notify_tx_error(bool result)
 {
     if (result)
@@ -78,6 +175,9 @@ static void timeout_timer_fired(void * p_context)
                                        false))
         {
             m_procedure_is_active = false;
+#if NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+            m_timeouts++;
+#endif // NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
         }
         else
         {
@@ -98,12 +198,21 @@ static void timeout_timer_retry(void)
 
 static void timeout_timer_start(void)
 {
+    uint32_t frame_time = nrf_802154_frame_duration_get(mp_frame[0], false, true);
+
+#if NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+    mp_ack_delay = ((mp_frame[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK) == FRAME_VERSION_2) ?
+                   &m_enh_ack_delay : &m_imm_ack_delay;
+#endif // NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+
     m_timer.callback  = timeout_timer_fired;
     m_timer.p_context = NULL;
     m_timer.t0        = nrf_802154_timer_sched_time_get();
-    m_timer.dt        = m_timeout +
-                        IMM_ACK_DURATION +
-                        nrf_802154_frame_duration_get(mp_frame[0], false, true);
+    m_timer.dt        = frame_time + ack_wait_time_get();
+
+#if NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+    m_tx_end_time = m_timer.t0 + frame_time;
+#endif // NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
 
     m_procedure_is_active = true;
 
@@ -170,8 +279,36 @@ void nrf_802154_ack_timeout_rx_ack_started_hook(void)
     assert(m_procedure_is_active);
 
     timeout_timer_stop();
+
+#if NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+    int32_t delay = (int32_t)(nrf_802154_timer_sched_time_get() - m_tx_end_time);
+
+    // Both timestamps are taken with the low power timer resolution, so the difference may be
+    // negative for an ACK that started right after the frame.
+    ack_delay_measure(mp_ack_delay, (delay > 0) ? (uint32_t)delay : 0);
+#endif // NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+}
+
+#if NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+
+void nrf_802154_ack_timeout_time_stats_get(nrf_802154_ack_timeout_stats_t * p_stats)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    p_stats->imm_ack  = m_imm_ack_delay.data;
+    p_stats->enh_ack  = m_enh_ack_delay.data;
+    p_stats->timeouts = m_timeouts;
+
+    p_stats->imm_ack.timeout = ack_delay_timeout_get(&m_imm_ack_delay,
+                                                     m_timeout + IMM_ACK_DURATION);
+    p_stats->enh_ack.timeout = ack_delay_timeout_get(&m_enh_ack_delay,
+                                                     m_timeout + IMM_ACK_DURATION);
+    __set_PRIMASK(primask);
 }
 
+#endif // NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+
 bool nrf_802154_ack_timeout_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error)
 {
     (void)error;
@@ -53,6 +53,7 @@
 #include "nrf_802154_request.h"
 #include "nrf_802154_rssi.h"
 #include "nrf_802154_rx_buffer.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_timer_coord.h"
 #include "nrf_radio.h"
 #include "platform/clock/nrf_802154_clock.h"
@@ -99,6 +100,26 @@ static void tx_buffer_fill(const uint8_t * p_data, uint8_t length)
     memcpy(&m_tx_buffer[RAW_PAYLOAD_OFFSET], p_data, length);
 }
 
+/**
+ * @brief Prepare a caller-owned buffer for transmission without copying.
+ *
+ * @param[in]  p_data   Pointer to array containing payload of a data to transmit, preceded by
+ *                      @ref NRF_802154_TX_BUFFER_HEADROOM bytes reserved for PHR.
+ * @param[in]  length   Length of given frame. This value shall exclude PHR and FCS fields.
+ *
+ * @return Pointer to the frame in the format used by the driver core.
+ */
+static uint8_t * tx_buffer_headroom_fill(uint8_t * p_data, uint8_t length)
+{
+    uint8_t * p_frame = p_data - RAW_PAYLOAD_OFFSET;
+
+    assert(length <= MAX_PACKET_SIZE - FCS_SIZE);
+
+    p_frame[RAW_LENGTH_OFFSET] = length + FCS_SIZE;
+
+    return p_frame;
+}
+
 #endif // !NRF_802154_USE_RAW_API
 
 /**
@@ -216,6 +237,7 @@ void nrf_802154_init(void)
     nrf_802154_rsch_crit_sect_init();
     nrf_802154_rsch_init();
     nrf_802154_rx_buffer_init();
+    nrf_802154_stats_init();
     nrf_802154_temperature_init();
     nrf_802154_timer_coord_init();
     nrf_802154_timer_sched_init();
@@ -393,8 +415,40 @@ bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca)
     return result;
 }
 
+bool nrf_802154_transmit_no_copy(uint8_t * p_data, uint8_t length, bool cca)
+{
+    bool result;
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TRANSMIT);
+
+    result = nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                         REQ_ORIG_HIGHER_LAYER,
+                                         tx_buffer_headroom_fill(p_data, length),
+                                         cca,
+                                         false,
+                                         NULL);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TRANSMIT);
+    return result;
+}
+
 #endif // NRF_802154_USE_RAW_API
 
+#if NRF_802154_TX_QUEUE_ENABLED
+bool nrf_802154_transmit_raw_enqueue(const uint8_t * p_data, bool cca)
+{
+    bool result;
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TRANSMIT);
+
+    result = nrf_802154_request_transmit_enqueue(p_data, cca);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TRANSMIT);
+    return result;
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
 bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
                                 bool            cca,
                                 uint32_t        t0,
@@ -438,6 +492,22 @@ bool nrf_802154_receive_at(uint32_t t0,
     return result;
 }
 
+bool nrf_802154_receive_periodic(uint32_t t0,
+                                 uint32_t period,
+                                 uint32_t window,
+                                 uint8_t  channel,
+                                 uint32_t count)
+{
+    bool result;
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RECEIVE_PERIODIC);
+
+    result = nrf_802154_delayed_trx_receive_periodic(t0, period, window, channel, count);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_RECEIVE_PERIODIC);
+    return result;
+}
+
 bool nrf_802154_receive_at_cancel(void)
 {
     bool result;
@@ -450,6 +520,20 @@ bool nrf_802154_receive_at_cancel(void)
     return result;
 }
 
+void nrf_802154_transmit_at_setup_time_get(nrf_802154_setup_time_t * p_data)
+{
+    assert(p_data != NULL);
+
+    nrf_802154_delayed_trx_tx_setup_time_get(p_data);
+}
+
+void nrf_802154_receive_at_setup_time_get(nrf_802154_setup_time_t * p_data)
+{
+    assert(p_data != NULL);
+
+    nrf_802154_delayed_trx_rx_setup_time_get(p_data);
+}
+
 bool nrf_802154_energy_detection(uint32_t time_us)
 {
     bool result;
@@ -624,6 +708,34 @@ bool nrf_802154_ack_data_clear(const uint8_t * p_addr, bool extended, uint8_t da
     return nrf_802154_ack_data_for_addr_clear(p_addr, extended, data_type);
 }
 
+bool nrf_802154_ack_data_set_batch(uint8_t    * p_addrs,
+                                   uint32_t     num_addrs,
+                                   bool         extended,
+                                   const void * p_data,
+                                   uint16_t     length,
+                                   uint8_t      data_type)
+{
+    if (length > NRF_802154_MAX_ACK_IE_SIZE)
+    {
+        return false;
+    }
+
+    return nrf_802154_ack_data_for_addr_set_batch(p_addrs,
+                                                  num_addrs,
+                                                  extended,
+                                                  data_type,
+                                                  p_data,
+                                                  length);
+}
+
+bool nrf_802154_ack_data_clear_batch(uint8_t * p_addrs,
+                                     uint32_t  num_addrs,
+                                     bool      extended,
+                                     uint8_t   data_type)
+{
+    return nrf_802154_ack_data_for_addr_clear_batch(p_addrs, num_addrs, extended, data_type);
+}
+
 void nrf_802154_auto_pending_bit_set(bool enabled)
 {
     nrf_802154_ack_data_enable(enabled);
@@ -661,15 +773,67 @@ void nrf_802154_cca_cfg_get(nrf_802154_cca_cfg_t * p_cca_cfg)
 }
 
 #if NRF_802154_CSMA_CA_ENABLED
+
+/**
+ * @brief Checks if given CSMA-CA parameters are allowed by the 802.15.4 specification.
+ *
+ * @param[in]  p_params  Pointer to the CSMA-CA parameters to check.
+ *
+ * @retval  true   Parameters are valid.
+ * @retval  false  Parameters are invalid.
+ */
+static bool csma_ca_params_are_valid(const nrf_802154_csma_ca_params_t * p_params)
+{
+    assert(p_params != NULL);
+
+    return (p_params->max_be >= CSMA_CA_MAX_BE_MIN) && (p_params->max_be <= CSMA_CA_BE_LIMIT) &&
+           (p_params->min_be <= p_params->max_be) &&
+           (p_params->max_csma_backoffs <= CSMA_CA_MAX_BACKOFFS_LIMIT);
+}
+
+bool nrf_802154_csma_ca_params_set(const nrf_802154_csma_ca_params_t * p_params)
+{
+    bool result = csma_ca_params_are_valid(p_params);
+
+    if (result)
+    {
+        nrf_802154_pib_csma_ca_params_set(p_params);
+    }
+
+    return result;
+}
+
+void nrf_802154_csma_ca_params_get(nrf_802154_csma_ca_params_t * p_params)
+{
+    nrf_802154_pib_csma_ca_params_get(p_params);
+}
+
 #if NRF_802154_USE_RAW_API
 
 void nrf_802154_transmit_csma_ca_raw(const uint8_t * p_data)
 {
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_CSMACA);
 
-    nrf_802154_csma_ca_start(p_data);
+    nrf_802154_csma_ca_start(p_data, NULL);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_CSMACA);
+}
+
+bool nrf_802154_transmit_csma_ca_raw_ex(const uint8_t                     * p_data,
+                                        const nrf_802154_csma_ca_params_t * p_params)
+{
+    bool result = csma_ca_params_are_valid(p_params);
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_CSMACA);
+
+    if (result)
+    {
+        nrf_802154_csma_ca_start(p_data, p_params);
+    }
 
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_CSMACA);
+
+    return result;
 }
 
 #else // NRF_802154_USE_RAW_API
@@ -680,7 +844,36 @@ void nrf_802154_transmit_csma_ca(const uint8_t * p_data, uint8_t length)
 
     tx_buffer_fill(p_data, length);
 
-    nrf_802154_csma_ca_start(m_tx_buffer);
+    nrf_802154_csma_ca_start(m_tx_buffer, NULL);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_CSMACA);
+}
+
+bool nrf_802154_transmit_csma_ca_ex(const uint8_t                     * p_data,
+                                    uint8_t                             length,
+                                    const nrf_802154_csma_ca_params_t * p_params)
+{
+    bool result = csma_ca_params_are_valid(p_params);
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_CSMACA);
+
+    if (result)
+    {
+        tx_buffer_fill(p_data, length);
+
+        nrf_802154_csma_ca_start(m_tx_buffer, p_params);
+    }
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_CSMACA);
+
+    return result;
+}
+
+void nrf_802154_transmit_csma_ca_no_copy(uint8_t * p_data, uint8_t length)
+{
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_CSMACA);
+
+    nrf_802154_csma_ca_start(tx_buffer_headroom_fill(p_data, length), NULL);
 
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_CSMACA);
 }
@@ -695,8 +888,29 @@ void nrf_802154_ack_timeout_set(uint32_t time)
     nrf_802154_ack_timeout_time_set(time);
 }
 
+#if NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+void nrf_802154_ack_timeout_stats_get(nrf_802154_ack_timeout_stats_t * p_stats)
+{
+    nrf_802154_ack_timeout_time_stats_get(p_stats);
+}
+
+#endif // NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+
 #endif // NRF_802154_ACK_TIMEOUT_ENABLED
 
+#if NRF_802154_STATS_ENABLED
+void nrf_802154_stats_get(nrf_802154_stats_t * p_stats)
+{
+    nrf_802154_stats_data_get(p_stats);
+}
+
+void nrf_802154_stats_reset(void)
+{
+    nrf_802154_stats_data_reset();
+}
+
+#endif // NRF_802154_STATS_ENABLED
+
 __WEAK void nrf_802154_tx_ack_started(const uint8_t * p_data)
 {
     (void)p_data;
@@ -712,14 +926,38 @@ __WEAK void nrf_802154_received_timestamp_raw(uint8_t * p_data,
                                               int8_t    power,
                                               uint8_t   lqi,
                                               uint32_t  time)
+{
+    const rx_buffer_t * p_buffer = (const rx_buffer_t *)p_data;
+
+    nrf_802154_received_ex(p_data, power, lqi, time, p_buffer->mhr_valid ? &p_buffer->mhr : NULL);
+}
+
+__WEAK void nrf_802154_received_ex(uint8_t                                  * p_data,
+                                   int8_t                                     power,
+                                   uint8_t                                    lqi,
+                                   uint32_t                                   time,
+                                   const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields)
 {
     (void)power;
     (void)lqi;
     (void)time;
+    (void)p_mhr_fields;
 
     nrf_802154_buffer_free_raw(p_data);
 }
 
+#if NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+__WEAK void nrf_802154_received_batch_raw(const nrf_802154_received_frame_t * p_frames,
+                                          uint32_t                            count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        nrf_802154_received_raw(p_frames[i].p_data, p_frames[i].power, p_frames[i].lqi);
+    }
+}
+
+#endif // NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+
 #else // NRF_802154_USE_RAW_API
 
 __WEAK void nrf_802154_received(uint8_t * p_data, uint8_t length, int8_t power, uint8_t lqi)
@@ -58,6 +58,12 @@ extern "C" {
  */
 #define NRF_802154_NO_TIMESTAMP 0
 
+/**
+ * @brief Number of bytes that must be reserved before a frame passed to the no-copy transmit
+ *        functions.
+ */
+#define NRF_802154_TX_BUFFER_HEADROOM 1
+
 /**
  * @brief Initializes the 802.15.4 driver.
  *
@@ -309,6 +315,9 @@ bool nrf_802154_receive(void);
  * If the requested reception time is in the past, the function returns false and does not
  * schedule reception.
  *
+ * Up to @ref NRF_802154_DELAYED_TRX_RX_SLOTS receptions can be scheduled at the same time. If all
+ * slots are in use, the function returns false.
+ *
  * A scheduled reception can be cancelled by a call to @ref nrf_802154_receive_at_cancel.
  *
  * @param[in]  t0       Base of delay time - absolute time used by the Timer Scheduler,
@@ -326,9 +335,49 @@ bool nrf_802154_receive_at(uint32_t t0,
                            uint8_t  channel);
 
 /**
- * @brief Cancels a delayed reception scheduled by a call to @ref nrf_802154_receive_at.
+ * @brief Requests reception in periodic receive windows.
+ *
+ * This function works as a repeated version of @ref nrf_802154_receive_at. The receive windows
+ * start at @p t0 + n * @p period, where n counts from 1 to @p count. Each window is placed
+ * relative to @p t0 on the Timer Scheduler time base, so the schedule does not drift.
+ *
+ * The driver schedules the next window by itself when a window ends. Frames received in any window
+ * are reported by @ref nrf_802154_received.
+ *
+ * The radio state after a window ends is the same for every window. The radio remains in
+ * the receive state, as it does after a window requested by @ref nrf_802154_receive_at, unless
+ * @ref NRF_802154_DELAYED_TRX_PERIODIC_RX_SLEEP_ENABLED is set. In that case the driver requests
+ * the sleep state after every window that is followed by another one, without terminating other
+ * ongoing operations.
+ * Only the end of the last window is reported by @ref nrf_802154_receive_failed with
+ * the @ref NRF_802154_RX_ERROR_DELAYED_TIMEOUT argument. Windows that cannot be started on time,
+ * for example because the radio is busy with another operation, are skipped.
+ *
+ * The windows occupy one of @ref NRF_802154_DELAYED_TRX_RX_SLOTS slots until the last window ends
+ * or @ref nrf_802154_receive_at_cancel is called.
+ *
+ * @param[in]  t0       Base of delay time - absolute time used by the Timer Scheduler,
+ *                      in microseconds (us).
+ * @param[in]  period   Distance between starts of consecutive receive windows, in microseconds (us).
+ *                      It must be longer than @p window.
+ * @param[in]  window   Length of each receive window, in microseconds (us).
+ * @param[in]  channel  Radio channel on which the frames are to be received.
+ * @param[in]  count    Number of receive windows. If 0, windows are scheduled until cancelled.
+ *
+ * @retval  true   The first receive window was scheduled.
+ * @retval  false  The driver could not schedule the reception procedure.
+ */
+bool nrf_802154_receive_periodic(uint32_t t0,
+                                 uint32_t period,
+                                 uint32_t window,
+                                 uint8_t  channel,
+                                 uint32_t count);
+
+/**
+ * @brief Cancels all delayed receptions scheduled by calls to @ref nrf_802154_receive_at and
+ *        @ref nrf_802154_receive_periodic.
  *
- * If the receive window has been scheduled but has not started yet, this function prevents
+ * If a receive window has been scheduled but has not started yet, this function prevents
  * entering the receive window. If the receive window has been scheduled and has already started,
  * the radio remains in the receive state, but a window timeout will not be reported.
  *
@@ -419,8 +468,78 @@ bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca);
  */
 bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca);
 
+/**
+ * @brief Changes the radio state to transmit without copying the given frame.
+ *
+ * This function works like @ref nrf_802154_transmit, but it passes the given buffer to the RADIO
+ * peripheral instead of copying it to the internal buffer. The byte preceding @p p_data is used
+ * by the driver to store PHR of the frame, so the buffer provided by the caller must reserve
+ * @ref NRF_802154_TX_BUFFER_HEADROOM bytes before the frame.
+ *
+ * The driver owns the buffer from the moment this function returns true until the buffer is
+ * returned to the higher layer in @ref nrf_802154_transmitted or @ref nrf_802154_transmit_failed,
+ * in which @p p_frame equals @p p_data. The buffer must not be modified in the meantime. If this
+ * function returns false, the buffer is not used by the driver.
+ *
+ * @verbatim
+ * p_data - NRF_802154_TX_BUFFER_HEADROOM
+ * v     p_data
+ * v     v
+ * +-----+-----------------------------------------------------------+------------+
+ * | PHR | MAC header and payload                                    | FCS        |
+ * +-----+-----------------------------------------------------------+------------+
+ *       |                                                           |
+ *       | <------------------ length -----------------------------> |
+ * @endverbatim
+ *
+ * @param[in]  p_data  Pointer to the array with the payload of data to transmit, preceded by
+ *                     @ref NRF_802154_TX_BUFFER_HEADROOM bytes owned by the caller. The array
+ *                     must have room for FCS after the payload.
+ * @param[in]  length  Length of the given frame. This value must exclude PHR and FCS fields from
+ *                     the given frame.
+ * @param[in]  cca     If the driver is to perform a CCA procedure before transmission.
+ *
+ * @retval  true   The transmission procedure was scheduled.
+ * @retval  false  The driver could not schedule the transmission procedure.
+ */
+bool nrf_802154_transmit_no_copy(uint8_t * p_data, uint8_t length, bool cca);
+
 #endif // NRF_802154_USE_RAW_API
 
+#if NRF_802154_TX_QUEUE_ENABLED
+
+/**
+ * @brief Requests transmission of a frame after the transmission in progress.
+ *
+ * @note This function is implemented in a zero-copy fashion. It passes the given buffer pointer to
+ *       the RADIO peripheral. The buffer must not be modified until the transmission
+ *       of the frame is notified.
+ *
+ * This function works like @ref nrf_802154_transmit_raw, but it does not abort the transmission
+ * in progress. If the driver is transmitting a frame or waiting for an ACK, the given frame
+ * is appended to the transmit queue. The queued frames are transmitted in order directly from
+ * the radio interrupt handler, as soon as the preceding transmission procedure ends.
+ *
+ * The end of the transmission procedure of every frame is notified separately by
+ * @ref nrf_802154_transmitted_raw or @ref nrf_802154_transmit_failed. If the transmission
+ * in progress is aborted by another request, all queued frames are notified by
+ * @ref nrf_802154_transmit_failed with the @ref NRF_802154_TX_ERROR_ABORTED argument.
+ *
+ * @note The transmit queue is intended for frames transmitted by the higher layer directly.
+ *       Transmissions performed by the CSMA-CA procedure or at the specified time are not queued
+ *       and abort the queued transmissions.
+ *
+ * @param[in]  p_data  Pointer to the array with data to transmit. See also
+ *                     @ref nrf_802154_transmit_raw.
+ * @param[in]  cca     If the driver is to perform a CCA procedure before transmission.
+ *
+ * @retval  true   The frame is being transmitted or has been queued.
+ * @retval  false  The transmit queue is full or the driver is busy with other procedure.
+ */
+bool nrf_802154_transmit_raw_enqueue(const uint8_t * p_data, bool cca);
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
 /**
  * @brief Requests transmission at the specified time.
  *
@@ -441,6 +560,9 @@ bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca);
  * If the requested transmission time is in the past, the function returns false and does not
  * schedule transmission.
  *
+ * Up to @ref NRF_802154_DELAYED_TRX_TX_SLOTS transmissions can be scheduled at the same time.
+ * If all slots are in use, the function returns false.
+ *
  * A successfully scheduled transmission can be cancelled by a call
  * to @ref nrf_802154_transmit_at_cancel.
  *
@@ -464,7 +586,7 @@ bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
                                 uint8_t         channel);
 
 /**
- * @brief Cancels a delayed transmission scheduled by a call to @ref nrf_802154_transmit_raw_at.
+ * @brief Cancels all delayed transmissions scheduled by calls to @ref nrf_802154_transmit_raw_at.
  *
  * If a delayed transmission has been scheduled but the transmission has not been started yet,
  * a call to this function prevents the transmission. If the transmission is ongoing,
@@ -478,6 +600,29 @@ bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
  */
 bool nrf_802154_transmit_at_cancel(void);
 
+/**
+ * @brief Gets the setup time of delayed transmissions.
+ *
+ * The setup time is the time the driver reserves between the start of the timeslot of a delayed
+ * transmission and the start of the radio ramp-up. If
+ * @ref NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED is set, the driver measures
+ * the setup time of every delayed transmission and this function provides the distribution of
+ * the measurements. Otherwise, only the fixed setup time is provided.
+ *
+ * @param[out]  p_data  Pointer to the structure to be filled with the setup time data.
+ */
+void nrf_802154_transmit_at_setup_time_get(nrf_802154_setup_time_t * p_data);
+
+/**
+ * @brief Gets the setup time of delayed receptions.
+ *
+ * This function works as @ref nrf_802154_transmit_at_setup_time_get for the receive windows
+ * requested by @ref nrf_802154_receive_at and @ref nrf_802154_receive_periodic.
+ *
+ * @param[out]  p_data  Pointer to the structure to be filled with the setup time data.
+ */
+void nrf_802154_receive_at_setup_time_get(nrf_802154_setup_time_t * p_data);
+
 /**
  * @brief Changes the radio state to energy detection.
  *
@@ -593,6 +738,59 @@ extern void nrf_802154_received_timestamp_raw(uint8_t * p_data,
                                               uint8_t   lqi,
                                               uint32_t  time);
 
+/**
+ * @brief Notifies that a frame was received, along with its parsed MAC header.
+ *
+ * This function works like @ref nrf_802154_received_timestamp_raw and adds the MAC header fields
+ * parsed by the driver during the reception to the parameter list, so the upper layer does not
+ * have to parse the header again.
+ *
+ * The default implementation of @ref nrf_802154_received_timestamp_raw calls this function.
+ *
+ * @note The structure pointed to by @p p_mhr_fields is stored in the receive buffer of the frame
+ *       and is valid until the buffer is released with @ref nrf_802154_buffer_free_raw.
+ *
+ * @param[in]  p_data        Pointer to a buffer that contains PHR and PSDU of the received frame.
+ *                           The first byte in the buffer is the length of the frame (PHR).
+ *                           The following bytes contain the frame itself (PSDU). The length byte
+ *                           (PHR) includes FCS. FCS is already verified by the hardware and may be
+ *                           modified by the hardware.
+ * @param[in]  power         RSSI of the received frame.
+ * @param[in]  lqi           LQI of the received frame.
+ * @param[in]  time          Timestamp taken when the last symbol of the frame was received, in
+ *                           microseconds (us), or @ref NRF_802154_NO_TIMESTAMP if the timestamp
+ *                           is invalid.
+ * @param[in]  p_mhr_fields  Pointer to the parsed MAC header of the frame, or NULL if the header
+ *                           of the frame is malformed.
+ */
+extern void nrf_802154_received_ex(uint8_t                                  * p_data,
+                                   int8_t                                     power,
+                                   uint8_t                                    lqi,
+                                   uint32_t                                   time,
+                                   const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields);
+
+#if NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+
+/**
+ * @brief Notifies that a batch of frames was received.
+ *
+ * This function is called instead of @ref nrf_802154_received_raw when
+ * @ref NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED is set. The frames are given in the order of their
+ * reception. Each frame buffer must be released with @ref nrf_802154_buffer_free_raw, as it is
+ * done for a frame notified by @ref nrf_802154_received_raw.
+ *
+ * The default implementation calls @ref nrf_802154_received_raw for each frame in the batch.
+ *
+ * @note The array pointed to by @p p_frames is valid only during the call of this function.
+ *
+ * @param[in]  p_frames  Array of descriptors of the received frames.
+ * @param[in]  count     Number of descriptors in the @p p_frames array.
+ */
+extern void nrf_802154_received_batch_raw(const nrf_802154_received_frame_t * p_frames,
+                                          uint32_t                            count);
+
+#endif // NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+
 #else // NRF_802154_USE_RAW_API
 
 /**
@@ -1065,6 +1263,55 @@ bool nrf_802154_ack_data_set(const uint8_t * p_addr,
  */
 bool nrf_802154_ack_data_clear(const uint8_t * p_addr, bool extended, uint8_t data_type);
 
+/**
+ * @brief Adds the addresses of multiple peer nodes for which the provided ACK data
+ * is to be added to the pending bit list.
+ *
+ * This function is equivalent to calling @ref nrf_802154_ack_data_set for every address
+ * in @p p_addrs, but the addresses are sorted once and merged into the list in a single pass.
+ * Either all addresses are added, or the list is left unmodified.
+ *
+ * @note The array pointed by @p p_addrs is sorted in place.
+ *
+ * @param[inout]  p_addrs    Array of bytes containing consecutive addresses of the nodes (little-endian).
+ * @param[in]     num_addrs  Number of addresses in @p p_addrs.
+ * @param[in]     extended   If the given addresses are extended MAC addresses or short MAC addresses.
+ * @param[in]     p_data     Pointer to the buffer containing data to be set for every address.
+ * @param[in]     length     Length of @p p_data. Must not exceed @ref NRF_802154_MAX_ACK_IE_SIZE.
+ * @param[in]     data_type  Type of data to be set. Refer to the @ref nrf_802154_ack_data_t type.
+ *
+ * @retval True   All addresses successfully added to the list.
+ * @retval False  Not enough memory to store all addresses in the list, or @p length is too big.
+ */
+bool nrf_802154_ack_data_set_batch(uint8_t    * p_addrs,
+                                   uint32_t     num_addrs,
+                                   bool         extended,
+                                   const void * p_data,
+                                   uint16_t     length,
+                                   uint8_t      data_type);
+
+/**
+ * @brief Removes the addresses of multiple peer nodes for which the ACK data is set from
+ * the pending bit list.
+ *
+ * This function is equivalent to calling @ref nrf_802154_ack_data_clear for every address
+ * in @p p_addrs, but the addresses are sorted once and removed from the list in a single pass.
+ *
+ * @note The array pointed by @p p_addrs is sorted in place.
+ *
+ * @param[inout]  p_addrs    Array of bytes containing consecutive addresses of the nodes (little-endian).
+ * @param[in]     num_addrs  Number of addresses in @p p_addrs.
+ * @param[in]     extended   If the given addresses are extended MAC addresses or short MAC addresses.
+ * @param[in]     data_type  Type of data to be removed. Refer to the @ref nrf_802154_ack_data_t type.
+ *
+ * @retval True   All addresses removed from the list.
+ * @retval False  At least one address not found in the list.
+ */
+bool nrf_802154_ack_data_clear_batch(uint8_t * p_addrs,
+                                     uint32_t  num_addrs,
+                                     bool      extended,
+                                     uint8_t   data_type);
+
 /**
  * @brief Enables or disables setting a pending bit in automatically transmitted ACK frames.
  *
@@ -1172,6 +1419,30 @@ void nrf_802154_cca_cfg_get(nrf_802154_cca_cfg_t * p_cca_cfg);
  * @{
  */
 #if NRF_802154_CSMA_CA_ENABLED
+
+/**
+ * @brief Configures the default parameters of the CSMA-CA procedure.
+ *
+ * The default parameters are used by the CSMA-CA procedures started without explicit parameters.
+ * They are initialized with @ref NRF_802154_CSMA_CA_MIN_BE, @ref NRF_802154_CSMA_CA_MAX_BE, and
+ * @ref NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS. The new parameters are used by the CSMA-CA procedures
+ * started after this call.
+ *
+ * @param[in]  p_params  Pointer to the CSMA-CA parameters structure.
+ *
+ * @retval  true   The parameters were set.
+ * @retval  false  The parameters were rejected, because @c max_be is below 3 or exceeds 8,
+ *                 @c min_be exceeds @c max_be or @c max_csma_backoffs exceeds 5.
+ */
+bool nrf_802154_csma_ca_params_set(const nrf_802154_csma_ca_params_t * p_params);
+
+/**
+ * @brief Gets the default parameters of the CSMA-CA procedure.
+ *
+ * @param[out]  p_params  Pointer to the structure for the current default CSMA-CA parameters.
+ */
+void nrf_802154_csma_ca_params_get(nrf_802154_csma_ca_params_t * p_params);
+
 #if NRF_802154_USE_RAW_API
 
 /**
@@ -1192,6 +1463,23 @@ void nrf_802154_cca_cfg_get(nrf_802154_cca_cfg_t * p_cca_cfg);
  */
 void nrf_802154_transmit_csma_ca_raw(const uint8_t * p_data);
 
+/**
+ * @brief Performs the CSMA-CA procedure with the given parameters and transmits a frame in case
+ *        of success.
+ *
+ * This function works like @ref nrf_802154_transmit_csma_ca_raw, but the backoff exponents and
+ * the maximum number of backoffs are taken from @p p_params instead of the defaults set by
+ * @ref nrf_802154_csma_ca_params_set. The parameters are copied.
+ *
+ * @param[in]  p_data    Pointer to the frame to transmit. See also @ref nrf_802154_transmit_raw.
+ * @param[in]  p_params  Pointer to the CSMA-CA parameters used for this transmission.
+ *
+ * @retval  true   The CSMA-CA procedure was started.
+ * @retval  false  The parameters are invalid. See @ref nrf_802154_csma_ca_params_set.
+ */
+bool nrf_802154_transmit_csma_ca_raw_ex(const uint8_t                     * p_data,
+                                        const nrf_802154_csma_ca_params_t * p_params);
+
 #else // NRF_802154_USE_RAW_API
 
 /**
@@ -1213,6 +1501,37 @@ void nrf_802154_transmit_csma_ca_raw(const uint8_t * p_data);
  */
 void nrf_802154_transmit_csma_ca(const uint8_t * p_data, uint8_t length);
 
+/**
+ * @brief Performs the CSMA-CA procedure with the given parameters and transmits a frame in case
+ *        of success.
+ *
+ * This function works like @ref nrf_802154_transmit_csma_ca, but the backoff exponents and
+ * the maximum number of backoffs are taken from @p p_params instead of the defaults set by
+ * @ref nrf_802154_csma_ca_params_set. The parameters are copied.
+ *
+ * @param[in]  p_data    Pointer to the frame to transmit. See also @ref nrf_802154_transmit.
+ * @param[in]  length    Length of the given frame. See also @ref nrf_802154_transmit.
+ * @param[in]  p_params  Pointer to the CSMA-CA parameters used for this transmission.
+ *
+ * @retval  true   The CSMA-CA procedure was started.
+ * @retval  false  The parameters are invalid. See @ref nrf_802154_csma_ca_params_set.
+ */
+bool nrf_802154_transmit_csma_ca_ex(const uint8_t                     * p_data,
+                                    uint8_t                             length,
+                                    const nrf_802154_csma_ca_params_t * p_params);
+
+/**
+ * @brief Performs the CSMA-CA procedure and transmits a frame without copying it.
+ *
+ * This function works like @ref nrf_802154_transmit_csma_ca, but the frame buffer is owned by
+ * the driver until the end of the procedure instead of being copied.
+ *
+ * @param[in]  p_data    Pointer to the frame to transmit. See also
+ *                       @ref nrf_802154_transmit_no_copy.
+ * @param[in]  length    Length of the given frame. See also @ref nrf_802154_transmit_no_copy.
+ */
+void nrf_802154_transmit_csma_ca_no_copy(uint8_t * p_data, uint8_t length);
+
 #endif // NRF_802154_USE_RAW_API
 #endif // NRF_802154_CSMA_CA_ENABLED
 
@@ -1233,8 +1552,48 @@ void nrf_802154_transmit_csma_ca(const uint8_t * p_data, uint8_t length);
  */
 void nrf_802154_ack_timeout_set(uint32_t time);
 
+#if NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+
+/**
+ * @brief Gets the ACK delays measured by the adaptive ACK timeout.
+ *
+ * The delays are measured from the end of a transmitted frame to the start of the received ACK,
+ * separately for Imm-Acks and Enh-Acks. The returned timeouts are the ones used for the next
+ * transmission of a frame expecting the given ACK type.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled with the ACK timeout statistics.
+ */
+void nrf_802154_ack_timeout_stats_get(nrf_802154_ack_timeout_stats_t * p_stats);
+
+#endif // NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+
 #endif // NRF_802154_ACK_TIMEOUT_ENABLED
 
+/**
+ * @}
+ * @defgroup nrf_802154_stats Driver statistics
+ * @{
+ */
+#if NRF_802154_STATS_ENABLED
+
+/**
+ * @brief Gets the statistics collected by the driver.
+ *
+ * The statistics are collected since the driver initialization or the last call to
+ * @ref nrf_802154_stats_reset. The returned copy is consistent, as the statistics are not updated
+ * while they are being copied.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled with the statistics.
+ */
+void nrf_802154_stats_get(nrf_802154_stats_t * p_stats);
+
+/**
+ * @brief Clears the statistics collected by the driver.
+ */
+void nrf_802154_stats_reset(void);
+
+#endif // NRF_802154_STATS_ENABLED
+
 /** @} */
 
 #ifdef __cplusplus
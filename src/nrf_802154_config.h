@@ -134,6 +134,24 @@ extern "C" {
 #define NRF_802154_SWI_PRIORITY 5
 #endif
 
+/**
+ * @def NRF_802154_SWI_REQ_QUEUE_SIZE
+ *
+ * The number of slots in the queue of requests passed to the software interrupt.
+ *
+ * Requests issued from contexts with priorities lower than @ref NRF_802154_SWI_PRIORITY, for
+ * example from threads of an RTOS, pass through this queue. A request occupies a slot from the
+ * moment the request function reserves it until the software interrupt processes the request.
+ * A request function preempted in between keeps its slot, so at most
+ * NRF_802154_SWI_REQ_QUEUE_SIZE request functions may be in progress at the same time. Set this
+ * value to at least the number of contexts that issue requests and can preempt each other.
+ * Exceeding the limit triggers an assertion.
+ *
+ */
+#ifndef NRF_802154_SWI_REQ_QUEUE_SIZE
+#define NRF_802154_SWI_REQ_QUEUE_SIZE 4
+#endif
+
 /**
  * @def NRF_802154_USE_RAW_API
  *
@@ -153,6 +171,11 @@ extern "C" {
  *
  * The number of slots containing short addresses of nodes for which the pending data is stored.
  *
+ * The same number of short addresses can have IE data set for the ACK. Both kinds of ACK data are
+ * kept in one table, so it has twice this many entries, each taking
+ * @ref NRF_802154_MAX_ACK_IE_SIZE + 4 bytes of RAM. An entry holding only the pending bit uses as
+ * much RAM as one holding IE data.
+ *
  */
 #ifndef NRF_802154_PENDING_SHORT_ADDRESSES
 #define NRF_802154_PENDING_SHORT_ADDRESSES 10
@@ -163,11 +186,30 @@ extern "C" {
  *
  * The number of slots containing extended addresses of nodes for which the pending data is stored.
  *
+ * As for @ref NRF_802154_PENDING_SHORT_ADDRESSES, the ACK data table has twice this many entries,
+ * each taking @ref NRF_802154_MAX_ACK_IE_SIZE + 10 bytes of RAM.
+ *
  */
 #ifndef NRF_802154_PENDING_EXTENDED_ADDRESSES
 #define NRF_802154_PENDING_EXTENDED_ADDRESSES 10
 #endif
 
+/**
+ * @def NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+ *
+ * If set to 1, the addresses of nodes for which ACK data is stored are kept in an open addressing
+ * hash table instead of a sorted array. Adding, removing, and searching for an address then take
+ * constant time regardless of @ref NRF_802154_PENDING_SHORT_ADDRESSES and
+ * @ref NRF_802154_PENDING_EXTENDED_ADDRESSES. The table keeps its load factor at or below 50%, so
+ * it has twice as many entries as the sorted array and takes twice as much RAM. With the default
+ * settings the ACK data table grows from 600 to 1200 bytes.
+ * It is recommended for devices serving a large number of sleepy nodes.
+ *
+ */
+#ifndef NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+#define NRF_802154_ACK_DATA_HASH_TABLE_ENABLED 0
+#endif
+
 /**
  * @def NRF_802154_RX_BUFFERS
  *
@@ -224,6 +266,93 @@ extern "C" {
 #define NRF_802154_DELAYED_TRX_ENABLED 1
 #endif
 
+/**
+ * @def NRF_802154_DELAYED_TRX_TX_SLOTS
+ *
+ * The number of delayed transmissions that can be scheduled at the same time.
+ *
+ * Each slot holds its own frame, CCA setting, and channel, so several transmissions can be
+ * requested with @ref nrf_802154_transmit_raw_at ahead of time.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_TX_SLOTS
+#define NRF_802154_DELAYED_TRX_TX_SLOTS 1
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_RX_SLOTS
+ *
+ * The number of receive windows that can be scheduled at the same time.
+ *
+ * Each slot holds its own channel and timeout, so several receive windows can be requested with
+ * @ref nrf_802154_receive_at ahead of time. The windows are not expected to overlap.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_RX_SLOTS
+#define NRF_802154_DELAYED_TRX_RX_SLOTS 1
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_PERIODIC_RX_SLEEP_ENABLED
+ *
+ * If the driver is to enter the sleep state between periodic receive windows requested with
+ * @ref nrf_802154_receive_periodic.
+ *
+ * If disabled, the radio remains in the receive state after every window, like after the last one.
+ * If enabled, the driver requests the sleep state after every window but the last one. The request
+ * does not abort other operations, but it overrides the receive state requested by the higher
+ * layer.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_PERIODIC_RX_SLEEP_ENABLED
+#define NRF_802154_DELAYED_TRX_PERIODIC_RX_SLEEP_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED
+ *
+ * If the driver is to measure the setup time of delayed operations and use the measured value
+ * instead of the fixed worst-case setup time.
+ *
+ * The setup time is measured with the Timer Coordinator, so this option requires
+ * @ref NRF_802154_FRAME_TIMESTAMP_ENABLED. The measurements can be read with
+ * @ref nrf_802154_transmit_at_setup_time_get and @ref nrf_802154_receive_at_setup_time_get.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED
+#define NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_SETUP_TIME_PERCENTILE
+ *
+ * Percentage of the measured setup times that the calibrated setup time must cover.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_SETUP_TIME_PERCENTILE
+#define NRF_802154_DELAYED_TRX_SETUP_TIME_PERCENTILE 99
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_SETUP_TIME_MIN_SAMPLES
+ *
+ * The number of setup time measurements needed before the calibrated setup time is used.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_SETUP_TIME_MIN_SAMPLES
+#define NRF_802154_DELAYED_TRX_SETUP_TIME_MIN_SAMPLES 16
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_SETUP_TIME_WINDOW
+ *
+ * The number of setup time measurements after which the weight of older measurements is halved.
+ *
+ */
+#ifndef NRF_802154_DELAYED_TRX_SETUP_TIME_WINDOW
+#define NRF_802154_DELAYED_TRX_SETUP_TIME_WINDOW 256
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_clock Clock driver configuration
@@ -298,6 +427,8 @@ extern "C" {
  * The minimum value of the backoff exponent (BE) in the CSMA-CA algorithm
  * (see IEEE 802.15.4-2015: 6.2.5.1).
  *
+ * This is the default value that can be changed at runtime with @ref nrf_802154_csma_ca_params_set.
+ *
  */
 #ifndef NRF_802154_CSMA_CA_MIN_BE
 #define NRF_802154_CSMA_CA_MIN_BE 3
@@ -309,6 +440,8 @@ extern "C" {
  * The maximum value of the backoff exponent, BE, in the CSMA-CA algorithm
  * (see IEEE 802.15.4-2015: 6.2.5.1).
  *
+ * This is the default value that can be changed at runtime with @ref nrf_802154_csma_ca_params_set.
+ *
  */
 #ifndef NRF_802154_CSMA_CA_MAX_BE
 #define NRF_802154_CSMA_CA_MAX_BE 5
@@ -318,7 +451,10 @@ extern "C" {
  * @def NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS
  *
  * The maximum number of backoffs that the CSMA-CA algorithm will attempt before declaring a channel
- * access failure.
+ * access failure. The allowed range is 0 to 5. The value of 0 works like 1: the channel access
+ * fails when the channel is found busy after the first backoff.
+ *
+ * This is the default value that can be changed at runtime with @ref nrf_802154_csma_ca_params_set.
  *
  */
 #ifndef NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS
@@ -342,6 +478,33 @@ extern "C" {
 #define NRF_802154_CSMA_CA_WAIT_FOR_TIMESLOT 1
 #endif
 
+/**
+ * @def NRF_802154_CSMA_CA_BACKOFF_SLACK
+ *
+ * The time in microseconds (us) by which the end of a random backoff period may be delayed, so that
+ * the timer scheduler can handle it together with other timers in a single wakeup.
+ *
+ */
+#ifndef NRF_802154_CSMA_CA_BACKOFF_SLACK
+#define NRF_802154_CSMA_CA_BACKOFF_SLACK 0
+#endif
+
+/**
+ * @def NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+ *
+ * If the CSMA-CA backoffs that follow a busy channel should be timed by the core using
+ * the high-resolution TIMER and PPI instead of the timer scheduler.
+ *
+ * When enabled, a busy channel detected during a CSMA-CA attempt is handled in the RADIO IRQ:
+ * the TIMER is armed with the next random backoff and triggers the CCA through PPI without
+ * issuing a new transmit request. Only the initial backoff and backoffs that do not fit
+ * the TIMER range are timed by the timer scheduler.
+ *
+ */
+#ifndef NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+#define NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED 0
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_timeout ACK timeout feature configuration
@@ -368,6 +531,17 @@ extern "C" {
 #define NRF_802154_ACK_TIMEOUT_DEFAULT_TIMEOUT 7000
 #endif
 
+/**
+ * @def NRF_802154_ACK_TIMEOUT_SLACK
+ *
+ * The time in microseconds (us) by which the ACK timeout may be delayed, so that the timer
+ * scheduler can handle it together with other timers in a single wakeup.
+ *
+ */
+#ifndef NRF_802154_ACK_TIMEOUT_SLACK
+#define NRF_802154_ACK_TIMEOUT_SLACK 0
+#endif
+
 /**
  * @def NRF_802154_ACK_TIMEOUT_DEFAULT_TIMEOUT
  *
@@ -378,6 +552,47 @@ extern "C" {
 #define NRF_802154_PRECISE_ACK_TIMEOUT_DEFAULT_TIMEOUT 210
 #endif
 
+/**
+ * @def NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+ *
+ * If the ACK timeout is to be adapted to the measured delay between the end of a transmitted frame
+ * and the start of the received ACK. The delays are tracked separately for Imm-Acks and Enh-Acks.
+ * The adapted timeout is the longest delay measured in the last two windows of
+ * @ref NRF_802154_ACK_TIMEOUT_ADAPTIVE_WINDOW samples increased by
+ * @ref NRF_802154_ACK_TIMEOUT_ADAPTIVE_MARGIN. It never exceeds the timeout set by
+ * @ref nrf_802154_ack_timeout_set.
+ *
+ * @note This option requires the precise ACK timeout implementation in
+ *       nrf_802154_precise_ack_timeout.c. The build fails if it is set for the ACK timeout
+ *       implementation based on the timer scheduler in nrf_802154_ack_timeout.c.
+ *
+ */
+#ifndef NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+#define NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ACK_TIMEOUT_ADAPTIVE_MARGIN
+ *
+ * The time in microseconds (us) added to the longest measured ACK delay. It must cover the
+ * resolution of the low power timer used to time the ACK timeout.
+ *
+ */
+#ifndef NRF_802154_ACK_TIMEOUT_ADAPTIVE_MARGIN
+#define NRF_802154_ACK_TIMEOUT_ADAPTIVE_MARGIN 64
+#endif
+
+/**
+ * @def NRF_802154_ACK_TIMEOUT_ADAPTIVE_WINDOW
+ *
+ * The number of ACK delay measurements after which the longest delay measured before is
+ * forgotten, so that the timeout follows changes of the peer devices.
+ *
+ */
+#ifndef NRF_802154_ACK_TIMEOUT_ADAPTIVE_WINDOW
+#define NRF_802154_ACK_TIMEOUT_ADAPTIVE_WINDOW 32
+#endif
+
 /**
  * @def NRF_802154_MAX_ACK_IE_SIZE
  *
@@ -410,6 +625,150 @@ extern "C" {
 #endif
 #endif // NRF_802154_TX_STARTED_NOTIFY_ENABLED
 
+/**
+ * @}
+ * @defgroup nrf_802154_config_tx_queue Transmit queue configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TX_QUEUE_ENABLED
+ *
+ * If the transmit queue is to be enabled by the driver. The transmit queue allows the higher layer
+ * to request transmission of a frame while another transmission is in progress. Queued frames
+ * are transmitted directly from the radio interrupt handler.
+ *
+ */
+#ifndef NRF_802154_TX_QUEUE_ENABLED
+#define NRF_802154_TX_QUEUE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TX_QUEUE_SIZE
+ *
+ * The number of frames that can wait in the transmit queue, excluding the frame being transmitted.
+ *
+ */
+#ifndef NRF_802154_TX_QUEUE_SIZE
+#define NRF_802154_TX_QUEUE_SIZE 4
+#endif
+
+/**
+ *@}
+ **/
+
+/**
+ * @defgroup nrf_802154_config_notify_batch Received frames batch notification configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+ *
+ * If the received frames are to be delivered to the higher layer in batches. If enabled, received
+ * frames are coalesced in the notification queue and delivered with a single call to
+ * @ref nrf_802154_received_batch_raw instead of a separate @ref nrf_802154_received_raw call for
+ * each frame. Notifications of other types are never delayed and preserve their order relative
+ * to the received frames.
+ *
+ * @note This option requires @ref NRF_802154_USE_RAW_API and applies only to notifications
+ *       delivered through the SWI notification module.
+ *
+ */
+#ifndef NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+#define NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_NOTIFY_RECEIVED_BATCH_THRESHOLD
+ *
+ * The number of received frames waiting in the notification queue that triggers delivery
+ * of the batch. It must not exceed @ref NRF_802154_RX_BUFFERS.
+ *
+ */
+#ifndef NRF_802154_NOTIFY_RECEIVED_BATCH_THRESHOLD
+#define NRF_802154_NOTIFY_RECEIVED_BATCH_THRESHOLD 4
+#endif
+
+/**
+ * @def NRF_802154_NOTIFY_RECEIVED_BATCH_TIMEOUT
+ *
+ * The maximum time in microseconds (us) a received frame waits in the notification queue before
+ * the batch is delivered, if @ref NRF_802154_NOTIFY_RECEIVED_BATCH_THRESHOLD is not reached.
+ *
+ */
+#ifndef NRF_802154_NOTIFY_RECEIVED_BATCH_TIMEOUT
+#define NRF_802154_NOTIFY_RECEIVED_BATCH_TIMEOUT 1000
+#endif
+
+/**
+ *@}
+ **/
+
+/**
+ * @defgroup nrf_802154_config_stats Statistics configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_STATS_ENABLED
+ *
+ * If the driver is to collect statistics available through @ref nrf_802154_stats_get. Durations
+ * of the radio IRQ handler and of handling of each RADIO event are measured with the DWT cycle
+ * counter, which is enabled by the driver during initialization. Activity of the timer scheduler
+ * and ACK frames that missed their transmission deadline are counted as well.
+ *
+ */
+#ifndef NRF_802154_STATS_ENABLED
+#define NRF_802154_STATS_ENABLED 0
+#endif
+
+/**
+ *@}
+ **/
+
+/**
+ * @defgroup nrf_802154_config_timer_sched Timer scheduler configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TIMER_SCHED_HEAP_ENABLED
+ *
+ * If the timer scheduler is to keep running timers in a binary heap instead of a sorted list.
+ * Adding and removing a timer then take logarithmic time regardless of the number of running
+ * timers, and are never retried when preempted.
+ *
+ * Unlike the lock-free list, the heap is modified with all interrupts disabled, including the
+ * RADIO interrupt. A single operation keeps interrupts disabled for at most one removal and one
+ * insertion in each of two heaps, one ordered by expiration time and one by expiration time plus
+ * slack. The time grows with the logarithm of @ref NRF_802154_TIMER_SCHED_HEAP_SIZE and does not
+ * depend on the slack of the timers. It is recommended for applications that run many timers
+ * concurrently and can accept this delay of interrupts.
+ *
+ */
+#ifndef NRF_802154_TIMER_SCHED_HEAP_ENABLED
+#define NRF_802154_TIMER_SCHED_HEAP_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TIMER_SCHED_HEAP_SIZE
+ *
+ * The maximum number of timers that can run concurrently if
+ * @ref NRF_802154_TIMER_SCHED_HEAP_ENABLED is set. It includes timers of the driver and timers of
+ * the higher layer that use the timer scheduler.
+ *
+ * The driver runs up to @ref NRF_802154_DELAYED_TRX_TX_SLOTS +
+ * 2 * @ref NRF_802154_DELAYED_TRX_RX_SLOTS timers for delayed operations, and one timer for each
+ * of CSMA-CA, ACK timeout and batched notifications of received frames, if enabled. The build
+ * fails if this option is smaller than that. If the higher layer runs more timers than the
+ * remaining capacity, @ref nrf_802154_timer_sched_add fails instead of overwriting memory.
+ *
+ */
+#ifndef NRF_802154_TIMER_SCHED_HEAP_SIZE
+#define NRF_802154_TIMER_SCHED_HEAP_SIZE 16
+#endif
+
 /**
  *@}
  **/
@@ -52,6 +52,7 @@
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_rssi.h"
 #include "nrf_802154_rx_buffer.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_utils.h"
 #include "nrf_802154_timer_coord.h"
 #include "nrf_802154_types.h"
@@ -85,6 +86,10 @@
 #define PPI_TIMER_TX_ACK           NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN    ///< PPI that connects TIMER COMPARE event with RADIO TXEN task
 #define PPI_CRCOK_DIS_PPI          NRF_802154_PPI_RADIO_CRCOK_TO_PPI_GRP_DISABLE ///< PPI that connects RADIO CRCOK event with task that disables PPI group
 
+#if NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+#define PPI_TIMER_CCA              NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_RXEN    ///< PPI that connects TIMER COMPARE event with RADIO RXEN task after CSMA-CA backoff
+#endif  // NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+
 #if NRF_802154_DISABLE_BCC_MATCHING
 #define PPI_ADDRESS_COUNTER_COUNT  NRF_802154_PPI_RADIO_ADDR_TO_COUNTER_COUNT    ///< PPI that connects RADIO ADDRESS event with TIMER COUNT task
 #define PPI_CRCERROR_COUNTER_CLEAR NRF_802154_PPI_RADIO_CRCERROR_COUNTER_CLEAR   ///< PPI that connects RADIO CRCERROR event with TIMER CLEAR task
@@ -145,6 +150,11 @@
 #define TXRU_TIME               40              ///< Transmitter ramp up time [us]
 #define EVENT_LAT               23              ///< END event latency [us]
 
+#if NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+#define HW_BACKOFF_MIN          2                                ///< Minimal delay between busy channel and CCA repeated by TIMER [us]
+#define HW_BACKOFF_MAX          (UINT16_MAX - RX_RAMP_UP_TIME)   ///< Maximal backoff that fits TIMER range together with LNA activation [us]
+#endif // NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+
 #define MAX_CRIT_SECT_TIME      60              ///< Maximal time that the driver spends in single critical section.
 
 #define LQI_VALUE_FACTOR        4               ///< Factor needed to calculate LQI value based on data from RADIO peripheral
@@ -220,6 +230,7 @@ typedef struct
 
 #if !NRF_802154_DISABLE_BCC_MATCHING
     bool psdu_being_received   : 1; ///< If PSDU is currently being received.
+    bool ack_being_prepared    : 1; ///< If ACK for the frame being received is being prepared in stages.
 
 #endif  // !NRF_802154_DISABLE_BCC_MATCHING
 #if NRF_802154_TX_STARTED_NOTIFY_ENABLED
@@ -232,6 +243,20 @@ static nrf_802154_flags_t m_flags;               ///< Flags used to store the cu
 
 static volatile bool m_rsch_timeslot_is_granted; ///< State of the RSCH timeslot.
 
+#if NRF_802154_TX_QUEUE_ENABLED
+/// Frame waiting in the transmit queue.
+typedef struct
+{
+    const uint8_t * p_data; ///< Pointer to the frame to transmit.
+    bool            cca;    ///< If CCA is to be performed before transmission of the frame.
+} tx_queue_entry_t;
+
+static tx_queue_entry_t m_tx_queue[NRF_802154_TX_QUEUE_SIZE]; ///< Frames waiting for transmission.
+static uint8_t          m_tx_queue_head;                      ///< Index of the oldest queued frame.
+static uint8_t          m_tx_queue_count;                     ///< Number of queued frames.
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
 /***************************************************************************************************
  * @section Common core operations
  **************************************************************************************************/
@@ -254,6 +279,7 @@ static void rx_flags_clear(void)
     m_flags.rx_timeslot_requested = false;
 #if !NRF_802154_DISABLE_BCC_MATCHING
     m_flags.psdu_being_received = false;
+    m_flags.ack_being_prepared  = false;
 #endif // !NRF_802154_DISABLE_BCC_MATCHING
 }
 
@@ -360,10 +386,9 @@ static void receive_started_notify(void)
 #endif
 
 /** Notify MAC layer that a frame was transmitted. */
-static void transmitted_frame_notify(uint8_t * p_ack, int8_t power, uint8_t lqi)
+static void transmitted_frame_notify(const uint8_t * p_frame, uint8_t * p_ack, int8_t power,
+                                     uint8_t lqi)
 {
-    const uint8_t * p_frame = mp_tx_data;
-
     nrf_802154_critical_section_nesting_allow();
 
     nrf_802154_core_hooks_transmitted(p_frame);
@@ -373,10 +398,8 @@ static void transmitted_frame_notify(uint8_t * p_ack, int8_t power, uint8_t lqi)
 }
 
 /** Notify MAC layer that transmission procedure failed. */
-static void transmit_failed_notify(nrf_802154_tx_error_t error)
+static void transmit_failed_notify(const uint8_t * p_frame, nrf_802154_tx_error_t error)
 {
-    const uint8_t * p_frame = mp_tx_data;
-
     if (nrf_802154_core_hooks_tx_failed(p_frame, error))
     {
         nrf_802154_notify_transmit_failed(p_frame, error);
@@ -384,11 +407,12 @@ static void transmit_failed_notify(nrf_802154_tx_error_t error)
 }
 
 /** Allow nesting critical sections and notify MAC layer that transmission procedure failed. */
-static void transmit_failed_notify_and_nesting_allow(nrf_802154_tx_error_t error)
+static void transmit_failed_notify_and_nesting_allow(const uint8_t       * p_frame,
+                                                     nrf_802154_tx_error_t error)
 {
     nrf_802154_critical_section_nesting_allow();
 
-    transmit_failed_notify(error);
+    transmit_failed_notify(p_frame, error);
 
     nrf_802154_critical_section_nesting_deny();
 }
@@ -504,6 +528,96 @@ static uint8_t * rx_buffer_get(void)
     return rx_buffer_is_available() ? mp_current_rx_buffer->data : NULL;
 }
 
+/** Parse MAC header of the frame in the current rx buffer and cache the result in the buffer.
+ *
+ * The cached header fields are reused by the ACK generator and passed to the upper layer with the
+ * received frame, so the header does not have to be parsed again.
+ */
+static void rx_buffer_mhr_parse(void)
+{
+    mp_current_rx_buffer->mhr_valid = nrf_802154_frame_parser_mhr_parse(
+        mp_current_rx_buffer->data,
+        &mp_current_rx_buffer->mhr);
+}
+
+/** Get MAC header fields cached in the current rx buffer.
+ *
+ * @returns Pointer to cached MAC header fields or NULL if the header could not be parsed.
+ */
+static const nrf_802154_frame_parser_mhr_data_t * rx_buffer_mhr_get(void)
+{
+    return mp_current_rx_buffer->mhr_valid ? &mp_current_rx_buffer->mhr : NULL;
+}
+
+#if NRF_802154_TX_QUEUE_ENABLED
+
+/***************************************************************************************************
+ * @section Transmit queue management
+ **************************************************************************************************/
+
+/** Append a frame to the transmit queue.
+ *
+ * @param[in]  p_data  Pointer to the frame to transmit.
+ * @param[in]  cca     If CCA is to be performed before transmission of the frame.
+ *
+ * @retval true   The frame has been queued.
+ * @retval false  The transmit queue is full.
+ */
+static bool tx_queue_push(const uint8_t * p_data, bool cca)
+{
+    tx_queue_entry_t * p_entry;
+
+    if (m_tx_queue_count >= NRF_802154_TX_QUEUE_SIZE)
+    {
+        return false;
+    }
+
+    p_entry         = &m_tx_queue[(m_tx_queue_head + m_tx_queue_count) % NRF_802154_TX_QUEUE_SIZE];
+    p_entry->p_data = p_data;
+    p_entry->cca    = cca;
+
+    m_tx_queue_count++;
+
+    return true;
+}
+
+/** Remove the oldest frame from the transmit queue.
+ *
+ * @param[out]  p_entry  Copy of the removed queue entry.
+ *
+ * @retval true   A frame has been removed from the queue.
+ * @retval false  The transmit queue is empty.
+ */
+static bool tx_queue_pop(tx_queue_entry_t * p_entry)
+{
+    if (m_tx_queue_count == 0)
+    {
+        return false;
+    }
+
+    *p_entry        = m_tx_queue[m_tx_queue_head];
+    m_tx_queue_head = (m_tx_queue_head + 1) % NRF_802154_TX_QUEUE_SIZE;
+    m_tx_queue_count--;
+
+    return true;
+}
+
+/** Remove all frames from the transmit queue and notify MAC layer that they were not transmitted.
+ *
+ * @param[in]  error  Reason of the failure passed with every notification.
+ */
+static void tx_queue_flush(nrf_802154_tx_error_t error)
+{
+    tx_queue_entry_t entry;
+
+    while (tx_queue_pop(&entry))
+    {
+        transmit_failed_notify(entry.p_data, error);
+    }
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
 /***************************************************************************************************
  * @section Radio parameters calculators
  **************************************************************************************************/
@@ -904,6 +1018,27 @@ static void fem_for_tx_set(bool cca)
     }
 }
 
+#if NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+/** Configure FEM for CCA and TX procedure repeated by TIMER after a backoff.
+ *
+ * @param[in]  backoff  Value of TIMER at which RADIO ramp up is triggered.
+ *
+ * @retval true   LNA is activated by TIMER and TIMER should be stopped by LNA compare channel.
+ * @retval false  LNA is not activated by TIMER.
+ */
+static bool fem_for_tx_backoff_set(uint32_t backoff)
+{
+    nrf_802154_fal_event_t timer = m_activate_rx_cc0;
+
+    timer.event.timer.counter_value += backoff;
+
+    (void)nrf_802154_fal_pa_configuration_set(&m_ccaidle, NULL);
+
+    return nrf_802154_fal_lna_configuration_set(&timer, &m_ccaidle) == NRF_SUCCESS;
+}
+
+#endif // NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+
 /** Reset FEM for TX procedure. */
 static void fem_for_tx_reset(bool disable_ppi_egu_timer_start)
 {
@@ -1149,6 +1284,9 @@ static void tx_terminate(void)
 
     nrf_ppi_channel_disable(PPI_DISABLED_EGU);
     nrf_ppi_channel_disable(PPI_EGU_RAMP_UP);
+#if NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+    nrf_ppi_channel_disable(PPI_TIMER_CCA);
+#endif // NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
 
     fem_for_tx_reset(true);
 
@@ -1396,7 +1534,7 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
 
                     if (notify)
                     {
-                        transmit_failed_notify(NRF_802154_TX_ERROR_ABORTED);
+                        transmit_failed_notify(mp_tx_data, NRF_802154_TX_ERROR_ABORTED);
                     }
                 }
                 else
@@ -1413,7 +1551,7 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
 
                     if (notify)
                     {
-                        transmit_failed_notify(NRF_802154_TX_ERROR_ABORTED);
+                        transmit_failed_notify(mp_tx_data, NRF_802154_TX_ERROR_ABORTED);
                     }
                 }
                 else
@@ -1463,6 +1601,14 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
             default:
                 assert(false);
         }
+
+#if NRF_802154_TX_QUEUE_ENABLED
+        if (result && (req_orig != REQ_ORIG_ACK_TIMEOUT) && (req_orig != REQ_ORIG_RSCH))
+        {
+            // Frames queued after the terminated transmission are not going to be transmitted.
+            tx_queue_flush(NRF_802154_TX_ERROR_ABORTED);
+        }
+#endif // NRF_802154_TX_QUEUE_ENABLED
     }
 
     return result;
@@ -1727,6 +1873,124 @@ static bool tx_init(const uint8_t * p_data, bool cca, bool disabled_was_triggere
     return true;
 }
 
+#if NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+/** Repeat CCA followed by transmission after a backoff timed by TIMER.
+ *
+ * This function is to be called when CCABUSY was detected in the RADIO_STATE_CCA_TX state. RADIO
+ * is disabled by CCABUSY_DISABLE short. Shorts and interrupts set by @ref tx_init are preserved,
+ * so the TIMER COMPARE event triggering RXEN restarts the whole CCA and TX sequence
+ * without CPU involvement.
+ *
+ * @param[in]  backoff  Time after which CCA is to be repeated [us].
+ *
+ * @retval true   CCA is going to be repeated after @p backoff.
+ * @retval false  The backoff cannot be timed by TIMER. Nothing was changed.
+ */
+static bool tx_backoff_hw_start(uint32_t backoff)
+{
+    bool lna_set;
+
+    if (backoff < HW_BACKOFF_MIN)
+    {
+        backoff = HW_BACKOFF_MIN;
+    }
+
+    if ((backoff > HW_BACKOFF_MAX) ||
+        !nrf_802154_rsch_timeslot_request(backoff + nrf_802154_tx_duration_get(mp_tx_data[0],
+                                                                                true,
+                                                                                ack_is_requested(
+                                                                                    mp_tx_data))))
+    {
+        return false;
+    }
+
+    // Prevent DISABLED event from starting TIMER for FEM and clear FEM set for previous CCA
+    nrf_ppi_channel_disable(PPI_DISABLED_EGU);
+    fem_for_tx_reset(true);
+
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_CLEAR);
+    nrf_timer_cc_write(NRF_802154_TIMER_INSTANCE, NRF_TIMER_CC_CHANNEL1, backoff);
+    nrf_timer_event_clear(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE1);
+
+    lna_set = fem_for_tx_backoff_set(backoff);
+    nrf_timer_shorts_enable(NRF_802154_TIMER_INSTANCE,
+                            lna_set ? NRF_TIMER_SHORT_COMPARE0_STOP_MASK :
+                            NRF_TIMER_SHORT_COMPARE1_STOP_MASK);
+
+    nrf_ppi_channel_endpoint_setup(PPI_TIMER_CCA,
+                                   (uint32_t)nrf_timer_event_address_get(
+                                       NRF_802154_TIMER_INSTANCE,
+                                       NRF_TIMER_EVENT_COMPARE1),
+                                   (uint32_t)nrf_radio_task_address_get(NRF_RADIO_TASK_RXEN));
+    nrf_ppi_channel_enable(PPI_TIMER_CCA);
+
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_START);
+
+    // Detect if PPI worked (timer is counting or TIMER event is marked)
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_CAPTURE3);
+    if (nrf_timer_cc_read(NRF_802154_TIMER_INSTANCE, NRF_TIMER_CC_CHANNEL3) >= backoff)
+    {
+        ppi_and_egu_delay_wait();
+
+        if (nrf_radio_state_get() == NRF_RADIO_STATE_DISABLED)
+        {
+            // Compare event was missed while RADIO was still disabling.
+            nrf_radio_task_trigger(NRF_RADIO_TASK_RXEN);
+        }
+    }
+
+    return true;
+}
+
+#endif // NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+
+#if NRF_802154_TX_QUEUE_ENABLED
+/** Begin transmission of the next frame from the transmit queue.
+ *
+ * This function is to be called after the previous transmission procedure was terminated.
+ *
+ * @retval true   Transmission of the next frame has begun. The state of the driver is updated.
+ * @retval false  The transmit queue is empty.
+ */
+static bool tx_queue_next_begin(void)
+{
+    tx_queue_entry_t entry;
+
+    if (!tx_queue_pop(&entry))
+    {
+        return false;
+    }
+
+    mp_tx_data = entry.p_data;
+    state_set(entry.cca ? RADIO_STATE_CCA_TX : RADIO_STATE_TX);
+
+    // If there is not enough time in the current timeslot the transmission is postponed until
+    // the next timeslot is granted, like a not immediate transmit request.
+    (void)tx_init(entry.p_data, entry.cca, true);
+
+    return true;
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
+/** Initialize the operation that follows the terminated transmission procedure.
+ *
+ * The next frame from the transmit queue is transmitted if there is any. Otherwise the driver
+ * enters the receive state.
+ */
+static void next_tx_or_rx_init(void)
+{
+#if NRF_802154_TX_QUEUE_ENABLED
+    if (tx_queue_next_begin())
+    {
+        return;
+    }
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
+    state_set(RADIO_STATE_RX);
+    rx_init(true);
+}
+
 /** Initialize ED operation */
 static void ed_init(bool disabled_was_triggered)
 {
@@ -1926,7 +2190,14 @@ static void cont_prec_denied(void)
             case RADIO_STATE_TX:
             case RADIO_STATE_RX_ACK:
                 state_set(RADIO_STATE_RX);
-                transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_TIMESLOT_ENDED);
+                transmit_failed_notify_and_nesting_allow(mp_tx_data,
+                                                         NRF_802154_TX_ERROR_TIMESLOT_ENDED);
+
+#if NRF_802154_TX_QUEUE_ENABLED
+                nrf_802154_critical_section_nesting_allow();
+                tx_queue_flush(NRF_802154_TX_ERROR_TIMESLOT_ENDED);
+                nrf_802154_critical_section_nesting_deny();
+#endif // NRF_802154_TX_QUEUE_ENABLED
                 break;
 
             case RADIO_STATE_ED:
@@ -1981,6 +2252,33 @@ static void irq_address_state_rx_ack(void)
 }
 
 #if !NRF_802154_DISABLE_BCC_MATCHING
+/**
+ * @brief Prepare the ACK for the frame being received as far as the received part allows.
+ *
+ * The ACK is prepared before CRCOK to shorten the time needed to handle that event. If the ACK
+ * generator needs more of the frame, BCMATCH is reconfigured to continue when it is received.
+ *
+ * @param[in]  num_data_bytes  Number of bytes of the frame already received, including PHR.
+ */
+static void ack_prepare(uint8_t num_data_bytes)
+{
+    uint8_t prev_num_data_bytes = num_data_bytes;
+
+    nrf_802154_ack_generator_prepare(mp_current_rx_buffer->data,
+                                     rx_buffer_mhr_get(),
+                                     &num_data_bytes);
+
+    if (num_data_bytes != prev_num_data_bytes)
+    {
+        nrf_radio_bcc_set(num_data_bytes * 8);
+        m_flags.ack_being_prepared = true;
+    }
+    else
+    {
+        m_flags.ack_being_prepared = false;
+    }
+}
+
 // This event is generated during frame reception to request Radio Scheduler timeslot
 // and to filter frame
 static void irq_bcmatch_state_rx(void)
@@ -2017,6 +2315,13 @@ static void irq_bcmatch_state_rx(void)
             else
             {
                 m_flags.frame_filtered = true;
+                rx_buffer_mhr_parse();
+
+                if (ack_is_requested(mp_current_rx_buffer->data) &&
+                    nrf_802154_pib_auto_ack_get())
+                {
+                    ack_prepare(num_data_bytes);
+                }
             }
         }
         else if ((filter_result == NRF_802154_RX_ERROR_INVALID_LENGTH) ||
@@ -2038,6 +2343,10 @@ static void irq_bcmatch_state_rx(void)
             // Promiscuous mode, allow incorrect frames. Nothing to do here.
         }
     }
+    else if (m_flags.ack_being_prepared)
+    {
+        ack_prepare(num_data_bytes);
+    }
 
     if ((!m_flags.rx_timeslot_requested) && (frame_accepted))
     {
@@ -2100,6 +2409,7 @@ static void irq_crcok_state_rx(void)
             if (num_data_bytes == prev_num_data_bytes)
             {
                 m_flags.frame_filtered = true;
+                rx_buffer_mhr_parse();
             }
         }
         else
@@ -2135,11 +2445,18 @@ static void irq_crcok_state_rx(void)
     {
         bool send_ack = false;
 
+        if (!m_flags.frame_filtered)
+        {
+            // Frame accepted in promiscuous mode, its header was not parsed during filtering.
+            rx_buffer_mhr_parse();
+        }
+
         if (m_flags.frame_filtered &&
             ack_is_requested(mp_current_rx_buffer->data) &&
             nrf_802154_pib_auto_ack_get())
         {
-            mp_ack = nrf_802154_ack_generator_create(mp_current_rx_buffer->data);
+            mp_ack = nrf_802154_ack_generator_create(mp_current_rx_buffer->data,
+                                                     rx_buffer_mhr_get());
             if (NULL != mp_ack)
             {
                 send_ack = true;
@@ -2212,6 +2529,8 @@ static void irq_crcok_state_rx(void)
                 }
             }
 
+            nrf_802154_stats_ack_add(wait_for_phyend);
+
             if (wait_for_phyend)
             {
                 state_set(RADIO_STATE_TX_ACK);
@@ -2428,6 +2747,11 @@ static void irq_phyend_state_tx_frame(void)
         return;
     }
 
+#if NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+    // TIMER is reused in RX ACK state. Prevent it from triggering CCA again.
+    nrf_ppi_channel_disable(PPI_TIMER_CCA);
+#endif // NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+
     if (ack_is_requested(mp_tx_data))
     {
         bool     rx_buffer_free = rx_buffer_is_available();
@@ -2512,19 +2836,21 @@ static void irq_phyend_state_tx_frame(void)
     }
     else
     {
+        const uint8_t * p_frame = mp_tx_data;
+
         tx_terminate();
-        state_set(RADIO_STATE_RX);
-        rx_init(true);
+        next_tx_or_rx_init();
 
-        transmitted_frame_notify(NULL, 0, 0);
+        transmitted_frame_notify(p_frame, NULL, 0, 0);
     }
 }
 
 static void irq_end_state_rx_ack(void)
 {
-    bool          ack_match    = ack_is_matched();
-    rx_buffer_t * p_ack_buffer = NULL;
-    uint8_t     * p_ack_data   = mp_current_rx_buffer->data;
+    bool            ack_match    = ack_is_matched();
+    rx_buffer_t   * p_ack_buffer = NULL;
+    uint8_t       * p_ack_data   = mp_current_rx_buffer->data;
+    const uint8_t * p_frame      = mp_tx_data;
 
     if (!ack_match &&
         ((mp_tx_data[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK) == FRAME_VERSION_2) &&
@@ -2561,18 +2887,18 @@ static void irq_end_state_rx_ack(void)
     }
 
     rx_ack_terminate();
-    state_set(RADIO_STATE_RX);
-    rx_init(true);
+    next_tx_or_rx_init();
 
     if (ack_match)
     {
-        transmitted_frame_notify(p_ack_buffer->data,           // phr + psdu
+        transmitted_frame_notify(p_frame,
+                                 p_ack_buffer->data,           // phr + psdu
                                  rssi_last_measurement_get(),  // rssi
                                  lqi_get(p_ack_buffer->data)); // lqi;
     }
     else
     {
-        transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_INVALID_ACK);
+        transmit_failed_notify_and_nesting_allow(p_frame, NRF_802154_TX_ERROR_INVALID_ACK);
     }
 }
 
@@ -2595,11 +2921,23 @@ static void irq_ccaidle_state_cca(void)
 
 static void irq_ccabusy_state_tx_frame(void)
 {
+    const uint8_t * p_frame = mp_tx_data;
+
+#if NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+    uint32_t backoff;
+
+    if ((m_state == RADIO_STATE_CCA_TX) &&
+        nrf_802154_core_hooks_tx_busy_channel(p_frame, &backoff) &&
+        tx_backoff_hw_start(backoff))
+    {
+        return;
+    }
+#endif // NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+
     tx_terminate();
-    state_set(RADIO_STATE_RX);
-    rx_init(true);
+    next_tx_or_rx_init();
 
-    transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_BUSY_CHANNEL);
+    transmit_failed_notify_and_nesting_allow(p_frame, NRF_802154_TX_ERROR_BUSY_CHANNEL);
 }
 
 static void irq_ccabusy_state_cca(void)
@@ -2646,6 +2984,7 @@ static void irq_edend_state_ed(void)
 static void irq_handler(void)
 {
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_IRQ_HANDLER);
+    nrf_802154_stats_irq_enter(NRF_802154_STATS_IRQ_ID_HANDLER);
 
     // Prevent interrupting of this handler by requests from higher priority code.
     nrf_802154_critical_section_forcefully_enter();
@@ -2654,6 +2993,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_ADDRESS))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_FRAMESTART);
+        nrf_802154_stats_irq_enter(NRF_802154_STATS_IRQ_ID_ADDRESS);
         nrf_radio_event_clear(NRF_RADIO_EVENT_ADDRESS);
 
         switch (m_state)
@@ -2675,6 +3015,7 @@ static void irq_handler(void)
                 assert(false);
         }
 
+        nrf_802154_stats_irq_exit(NRF_802154_STATS_IRQ_ID_ADDRESS);
         nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_FRAMESTART);
     }
 
@@ -2684,6 +3025,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_BCMATCH))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_BCMATCH);
+        nrf_802154_stats_irq_enter(NRF_802154_STATS_IRQ_ID_BCMATCH);
         nrf_radio_event_clear(NRF_RADIO_EVENT_BCMATCH);
 
         switch (m_state)
@@ -2696,6 +3038,7 @@ static void irq_handler(void)
                 assert(false);
         }
 
+        nrf_802154_stats_irq_exit(NRF_802154_STATS_IRQ_ID_BCMATCH);
         nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_BCMATCH);
     }
 
@@ -2706,6 +3049,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_CRCERROR))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_CRCERROR);
+        nrf_802154_stats_irq_enter(NRF_802154_STATS_IRQ_ID_CRCERROR);
         nrf_radio_event_clear(NRF_RADIO_EVENT_CRCERROR);
 
         switch (m_state)
@@ -2718,6 +3062,7 @@ static void irq_handler(void)
                 assert(false);
         }
 
+        nrf_802154_stats_irq_exit(NRF_802154_STATS_IRQ_ID_CRCERROR);
         nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_CRCERROR);
     }
 #endif // !NRF_802154_DISABLE_BCC_MATCHING || NRF_802154_NOTIFY_CRCERROR
@@ -2726,6 +3071,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_CRCOK))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_CRCOK);
+        nrf_802154_stats_irq_enter(NRF_802154_STATS_IRQ_ID_CRCOK);
         nrf_radio_event_clear(NRF_RADIO_EVENT_CRCOK);
 
         switch (m_state)
@@ -2738,6 +3084,7 @@ static void irq_handler(void)
                 assert(false);
         }
 
+        nrf_802154_stats_irq_exit(NRF_802154_STATS_IRQ_ID_CRCOK);
         nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_CRCOK);
     }
 
@@ -2745,6 +3092,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_PHYEND))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_PHYEND);
+        nrf_802154_stats_irq_enter(NRF_802154_STATS_IRQ_ID_PHYEND);
         nrf_radio_event_clear(NRF_RADIO_EVENT_PHYEND);
 
         switch (m_state)
@@ -2762,6 +3110,7 @@ static void irq_handler(void)
                 assert(false);
         }
 
+        nrf_802154_stats_irq_exit(NRF_802154_STATS_IRQ_ID_PHYEND);
         nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_PHYEND);
     }
 
@@ -2769,6 +3118,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_END))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_END);
+        nrf_802154_stats_irq_enter(NRF_802154_STATS_IRQ_ID_END);
         nrf_radio_event_clear(NRF_RADIO_EVENT_END);
 
         switch (m_state)
@@ -2781,6 +3131,7 @@ static void irq_handler(void)
                 assert(false);
         }
 
+        nrf_802154_stats_irq_exit(NRF_802154_STATS_IRQ_ID_END);
         nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_END);
     }
 
@@ -2788,6 +3139,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_DISABLED))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_DISABLED);
+        nrf_802154_stats_irq_enter(NRF_802154_STATS_IRQ_ID_DISABLED);
         nrf_radio_event_clear(NRF_RADIO_EVENT_DISABLED);
 
         switch (m_state)
@@ -2800,6 +3152,7 @@ static void irq_handler(void)
                 assert(false);
         }
 
+        nrf_802154_stats_irq_exit(NRF_802154_STATS_IRQ_ID_DISABLED);
         nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_DISABLED);
     }
 
@@ -2807,6 +3160,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_CCAIDLE))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_CCAIDLE);
+        nrf_802154_stats_irq_enter(NRF_802154_STATS_IRQ_ID_CCAIDLE);
         nrf_radio_event_clear(NRF_RADIO_EVENT_CCAIDLE);
 
         switch (m_state)
@@ -2819,6 +3173,7 @@ static void irq_handler(void)
                 assert(false);
         }
 
+        nrf_802154_stats_irq_exit(NRF_802154_STATS_IRQ_ID_CCAIDLE);
         nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_CCAIDLE);
     }
 
@@ -2826,6 +3181,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_CCABUSY))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_CCABUSY);
+        nrf_802154_stats_irq_enter(NRF_802154_STATS_IRQ_ID_CCABUSY);
         nrf_radio_event_clear(NRF_RADIO_EVENT_CCABUSY);
 
         switch (m_state)
@@ -2843,6 +3199,7 @@ static void irq_handler(void)
                 assert(false);
         }
 
+        nrf_802154_stats_irq_exit(NRF_802154_STATS_IRQ_ID_CCABUSY);
         nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_CCABUSY);
     }
 
@@ -2850,6 +3207,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_EDEND))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_EDEND);
+        nrf_802154_stats_irq_enter(NRF_802154_STATS_IRQ_ID_EDEND);
         nrf_radio_event_clear(NRF_RADIO_EVENT_EDEND);
 
         switch (m_state)
@@ -2862,11 +3220,13 @@ static void irq_handler(void)
                 assert(false);
         }
 
+        nrf_802154_stats_irq_exit(NRF_802154_STATS_IRQ_ID_EDEND);
         nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_EDEND);
     }
 
     nrf_802154_critical_section_exit();
 
+    nrf_802154_stats_irq_exit(NRF_802154_STATS_IRQ_ID_HANDLER);
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_IRQ_HANDLER);
 }
 
@@ -2941,8 +3301,14 @@ bool nrf_802154_core_receive(nrf_802154_term_t              term_lvl,
 
                 if (result)
                 {
-                    state_set(RADIO_STATE_RX);
-                    rx_init(true);
+#if NRF_802154_TX_QUEUE_ENABLED
+                    // Missing ACK ends transmission procedure of a frame, but not of the queued ones.
+                    if ((req_orig != REQ_ORIG_ACK_TIMEOUT) || !tx_queue_next_begin())
+#endif // NRF_802154_TX_QUEUE_ENABLED
+                    {
+                        state_set(RADIO_STATE_RX);
+                        rx_init(true);
+                    }
                 }
             }
             else
@@ -2969,6 +3335,49 @@ bool nrf_802154_core_receive(nrf_802154_term_t              term_lvl,
     return result;
 }
 
+/** Terminate current operation and begin transmission of a frame.
+ *
+ * @note This function is to be called inside a critical section.
+ *
+ * @param[in]  term_lvl   Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig   Module that originates this request.
+ * @param[in]  p_data     Pointer to a frame to transmit.
+ * @param[in]  cca        If the driver is to perform CCA procedure before transmission.
+ * @param[in]  immediate  If the transmission is to be scheduled immediately or never.
+ *
+ * @retval true   The driver entered the transmit state.
+ * @retval false  The driver could not enter the transmit state.
+ */
+static bool transmit_begin(nrf_802154_term_t term_lvl,
+                           req_originator_t  req_orig,
+                           const uint8_t   * p_data,
+                           bool              cca,
+                           bool              immediate)
+{
+    bool result = current_operation_terminate(term_lvl, req_orig, true);
+
+    if (result)
+    {
+        // Set state to RX in case sleep terminate succeeded, but transmit_begin fails.
+        state_set(RADIO_STATE_RX);
+
+        mp_tx_data = p_data;
+        result     = tx_init(p_data, cca, true);
+
+        if (!immediate)
+        {
+            result = true;
+        }
+    }
+
+    if (result)
+    {
+        state_set(cca ? RADIO_STATE_CCA_TX : RADIO_STATE_TX);
+    }
+
+    return result;
+}
+
 bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
                               req_originator_t               req_orig,
                               const uint8_t                * p_data,
@@ -2980,26 +3389,7 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
 
     if (result)
     {
-        result = current_operation_terminate(term_lvl, req_orig, true);
-
-        if (result)
-        {
-            // Set state to RX in case sleep terminate succeeded, but transmit_begin fails.
-            state_set(RADIO_STATE_RX);
-
-            mp_tx_data = p_data;
-            result     = tx_init(p_data, cca, true);
-
-            if (!immediate)
-            {
-                result = true;
-            }
-        }
-
-        if (result)
-        {
-            state_set(cca ? RADIO_STATE_CCA_TX : RADIO_STATE_TX);
-        }
+        result = transmit_begin(term_lvl, req_orig, p_data, cca, immediate);
 
         if (notify_function != NULL)
         {
@@ -3019,6 +3409,38 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
     return result;
 }
 
+#if NRF_802154_TX_QUEUE_ENABLED
+
+bool nrf_802154_core_transmit_enqueue(const uint8_t * p_data, bool cca)
+{
+    bool result = critical_section_enter_and_verify_timeslot_length();
+
+    if (result)
+    {
+        switch (m_state)
+        {
+            case RADIO_STATE_CCA_TX:
+            case RADIO_STATE_TX:
+            case RADIO_STATE_RX_ACK:
+                result = tx_queue_push(p_data, cca);
+                break;
+
+            default:
+                result = transmit_begin(NRF_802154_TERM_NONE,
+                                        REQ_ORIG_HIGHER_LAYER,
+                                        p_data,
+                                        cca,
+                                        false);
+        }
+
+        nrf_802154_critical_section_exit();
+    }
+
+    return result;
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
 bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
 {
     bool result = critical_section_enter_and_verify_timeslot_length();
@@ -3086,7 +3508,7 @@ bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
     rx_buffer_t * p_buffer     = (rx_buffer_t *)p_data;
     bool          in_crit_sect = critical_section_enter_and_verify_timeslot_length();
 
-    p_buffer->free = true;
+    nrf_802154_rx_buffer_release(p_buffer);
 
     if (in_crit_sect)
     {
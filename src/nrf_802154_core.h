@@ -145,6 +145,26 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
                               bool                           immediate,
                               nrf_802154_notification_func_t notify_function);
 
+#if NRF_802154_TX_QUEUE_ENABLED
+
+/**
+ * @brief Requests transmission of a frame after the transmission in progress.
+ *
+ * If the driver is transmitting a frame or waiting for an ACK, the frame is appended to the
+ * transmit queue. Queued frames are transmitted one after another as soon as the preceding
+ * transmission procedure ends. If there is no transmission in progress, this function works
+ * like @ref nrf_802154_core_transmit requested by the higher layer.
+ *
+ * @param[in]  p_data  Pointer to a frame to transmit.
+ * @param[in]  cca     If the driver is to perform CCA procedure before transmission.
+ *
+ * @retval  true   The frame is being transmitted or has been queued.
+ * @retval  false  The transmit queue is full or the driver is performing other procedure.
+ */
+bool nrf_802154_core_transmit_enqueue(const uint8_t * p_data, bool cca);
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
 /**
  * @brief Requests the transition to the @ref RADIO_STATE_ED state.
  *
@@ -51,6 +51,7 @@ typedef bool (* abort_hook)(nrf_802154_term_t term_lvl, req_originator_t req_ori
 typedef void (* transmitted_hook)(const uint8_t * p_frame);
 typedef bool (* tx_failed_hook)(const uint8_t * p_frame, nrf_802154_tx_error_t error);
 typedef bool (* tx_started_hook)(const uint8_t * p_frame);
+typedef bool (* tx_busy_channel_hook)(const uint8_t * p_frame, uint32_t * p_backoff);
 typedef void (* rx_started_hook)(const uint8_t * p_frame);
 typedef void (* rx_ack_started_hook)(void);
 
@@ -111,6 +112,15 @@ static const tx_started_hook m_tx_started_hooks[] =
     NULL,
 };
 
+static const tx_busy_channel_hook m_tx_busy_channel_hooks[] =
+{
+#if NRF_802154_CSMA_CA_ENABLED && NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+    nrf_802154_csma_ca_tx_busy_channel_hook,
+#endif
+
+    NULL,
+};
+
 static const rx_started_hook m_rx_started_hooks[] =
 {
 #if NRF_802154_DELAYED_TRX_ENABLED
@@ -208,6 +218,29 @@ bool nrf_802154_core_hooks_tx_started(const uint8_t * p_frame)
     return result;
 }
 
+bool nrf_802154_core_hooks_tx_busy_channel(const uint8_t * p_frame, uint32_t * p_backoff)
+{
+    bool result = false;
+
+    for (uint32_t i = 0; i < sizeof(m_tx_busy_channel_hooks) / sizeof(m_tx_busy_channel_hooks[0]);
+         i++)
+    {
+        if (m_tx_busy_channel_hooks[i] == NULL)
+        {
+            break;
+        }
+
+        result = m_tx_busy_channel_hooks[i](p_frame, p_backoff);
+
+        if (result)
+        {
+            break;
+        }
+    }
+
+    return result;
+}
+
 void nrf_802154_core_hooks_rx_started(const uint8_t * p_frame)
 {
     for (uint32_t i = 0; i < sizeof(m_rx_started_hooks) / sizeof(m_rx_started_hooks[0]); i++)
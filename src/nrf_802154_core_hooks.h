@@ -91,6 +91,18 @@ bool nrf_802154_core_hooks_tx_failed(const uint8_t * p_frame, nrf_802154_tx_erro
  */
 bool nrf_802154_core_hooks_tx_started(const uint8_t * p_frame);
 
+/**
+ * @brief Processes hooks for the busy channel detected during CCA preceding a transmission.
+ *
+ * @param[in]   p_frame    Pointer to a buffer that contains PHR and PSDU of the frame
+ *                         that was not transmitted.
+ * @param[out]  p_backoff  Time in microseconds after which the CCA is to be repeated.
+ *
+ * @retval  true   The core is to repeat the CCA followed by the transmission after @p p_backoff.
+ * @retval  false  The transmission is to be terminated with a busy channel error.
+ */
+bool nrf_802154_core_hooks_tx_busy_channel(const uint8_t * p_frame, uint32_t * p_backoff);
+
 /**
  * @brief Processes hooks for the RX started event.
  *
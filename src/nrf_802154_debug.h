@@ -59,6 +59,7 @@ extern "C" {
 #define FUNCTION_RECEIVE_AT         0x000AUL
 #define FUNCTION_TRANSMIT_AT_CANCEL 0x000BUL
 #define FUNCTION_RECEIVE_AT_CANCEL  0x000CUL
+#define FUNCTION_RECEIVE_PERIODIC   0x000DUL
 
 #define FUNCTION_IRQ_HANDLER        0x0100UL
 #define FUNCTION_EVENT_FRAMESTART   0x0101UL
@@ -97,6 +98,7 @@ extern "C" {
 #define FUNCTION_CSMA_TX_STARTED                   0x0502UL
 #define FUNCTION_CSMA_CHANNEL_BUSY                 0x0503UL
 #define FUNCTION_CSMA_FRAME_TRANSMIT               0x0504UL
+#define FUNCTION_CSMA_TX_BUSY_CHANNEL              0x0505UL
 
 #define FUNCTION_TSCH_ADD                          0x0600UL
 #define FUNCTION_TSCH_FIRED                        0x0601UL
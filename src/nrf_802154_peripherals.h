@@ -287,6 +287,21 @@ extern "C" {
 #define NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN NRF_PPI_CHANNEL9
 #endif
 
+/**
+ * @def NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_RXEN
+ *
+ * The PPI channel that connects TIMER_COMPARE event to RADIO_RXEN task to start CCA after
+ * a CSMA-CA backoff timed by the core.
+ *
+ * @note This option is used by the core module only if @ref NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+ *       is set. By default the peripheral is shared with
+ *       @ref NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN, which is not used during the backoff.
+ *
+ */
+#ifndef NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_RXEN
+#define NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_RXEN NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN
+#endif
+
 /**
  * @def NRF_802154_PPI_RADIO_CRCOK_TO_PPI_GRP_DISABLE
  *
@@ -476,6 +491,7 @@ extern "C" {
                                            (1 << NRF_802154_PPI_RADIO_CRCERROR_TO_TIMER_CLEAR) |    \
                                            (1 << NRF_802154_PPI_RADIO_CCAIDLE_TO_FEM_GPIOTE) |      \
                                            (1 << NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN) |      \
+                                           (1 << NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_RXEN) |      \
                                            (1 << NRF_802154_PPI_RADIO_CRCOK_TO_PPI_GRP_DISABLE) |   \
                                            NRF_802154_DISABLE_BCC_MATCHING_PPI_CHANNELS_USED_MASK | \
                                            NRF_802154_TIMESTAMP_PPI_CHANNELS_USED_MASK |            \
@@ -48,15 +48,18 @@
 
 typedef struct
 {
-    int8_t               tx_power;                             ///< Transmit power.
-    uint8_t              pan_id[PAN_ID_SIZE];                  ///< Pan Id of this node.
-    uint8_t              short_addr[SHORT_ADDRESS_SIZE];       ///< Short Address of this node.
-    uint8_t              extended_addr[EXTENDED_ADDRESS_SIZE]; ///< Extended Address of this node.
-    nrf_802154_cca_cfg_t cca;                                  ///< CCA mode and thresholds.
-    bool                 promiscuous : 1;                      ///< Indicating if radio is in promiscuous mode.
-    bool                 auto_ack    : 1;                      ///< Indicating if auto ACK procedure is enabled.
-    bool                 pan_coord   : 1;                      ///< Indicating if radio is configured as the PAN coordinator.
-    uint8_t              channel     : 5;                      ///< Channel on which the node receives messages.
+    int8_t                      tx_power;                             ///< Transmit power.
+    uint8_t                     pan_id[PAN_ID_SIZE];                  ///< Pan Id of this node.
+    uint8_t                     short_addr[SHORT_ADDRESS_SIZE];       ///< Short Address of this node.
+    uint8_t                     extended_addr[EXTENDED_ADDRESS_SIZE]; ///< Extended Address of this node.
+    nrf_802154_cca_cfg_t        cca;                                  ///< CCA mode and thresholds.
+#if NRF_802154_CSMA_CA_ENABLED
+    nrf_802154_csma_ca_params_t csma_ca;                              ///< Default CSMA-CA parameters.
+#endif // NRF_802154_CSMA_CA_ENABLED
+    bool                        promiscuous : 1;                      ///< Indicating if radio is in promiscuous mode.
+    bool                        auto_ack    : 1;                      ///< Indicating if auto ACK procedure is enabled.
+    bool                        pan_coord   : 1;                      ///< Indicating if radio is configured as the PAN coordinator.
+    uint8_t                     channel     : 5;                      ///< Channel on which the node receives messages.
 } nrf_802154_pib_data_t;
 
 // Static variables.
@@ -136,6 +139,12 @@ void nrf_802154_pib_init(void)
     m_data.cca.ed_threshold   = NRF_802154_CCA_ED_THRESHOLD_DEFAULT;
     m_data.cca.corr_threshold = NRF_802154_CCA_CORR_THRESHOLD_DEFAULT;
     m_data.cca.corr_limit     = NRF_802154_CCA_CORR_LIMIT_DEFAULT;
+
+#if NRF_802154_CSMA_CA_ENABLED
+    m_data.csma_ca.min_be            = NRF_802154_CSMA_CA_MIN_BE;
+    m_data.csma_ca.max_be            = NRF_802154_CSMA_CA_MAX_BE;
+    m_data.csma_ca.max_csma_backoffs = NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS;
+#endif // NRF_802154_CSMA_CA_ENABLED
 }
 
 bool nrf_802154_pib_promiscuous_get(void)
@@ -249,3 +258,22 @@ void nrf_802154_pib_cca_cfg_get(nrf_802154_cca_cfg_t * p_cca_cfg)
 {
     memcpy(p_cca_cfg, &m_data.cca, sizeof(m_data.cca));
 }
+
+#if NRF_802154_CSMA_CA_ENABLED
+
+void nrf_802154_pib_csma_ca_params_set(const nrf_802154_csma_ca_params_t * p_params)
+{
+    assert(p_params->min_be <= p_params->max_be);
+    assert(p_params->max_be >= CSMA_CA_MAX_BE_MIN);
+    assert(p_params->max_be <= CSMA_CA_BE_LIMIT);
+    assert(p_params->max_csma_backoffs <= CSMA_CA_MAX_BACKOFFS_LIMIT);
+
+    memcpy(&m_data.csma_ca, p_params, sizeof(m_data.csma_ca));
+}
+
+void nrf_802154_pib_csma_ca_params_get(nrf_802154_csma_ca_params_t * p_params)
+{
+    memcpy(p_params, &m_data.csma_ca, sizeof(m_data.csma_ca));
+}
+
+#endif // NRF_802154_CSMA_CA_ENABLED
@@ -186,6 +186,24 @@ void nrf_802154_pib_cca_cfg_set(const nrf_802154_cca_cfg_t * p_cca_cfg);
  */
 void nrf_802154_pib_cca_cfg_get(nrf_802154_cca_cfg_t * p_cca_cfg);
 
+#if NRF_802154_CSMA_CA_ENABLED
+
+/**
+ * @brief Sets the default parameters of the CSMA-CA procedure.
+ *
+ * @param[in] p_params Pointer to the CSMA-CA parameters structure.
+ */
+void nrf_802154_pib_csma_ca_params_set(const nrf_802154_csma_ca_params_t * p_params);
+
+/**
+ * @brief Gets the default parameters of the CSMA-CA procedure.
+ *
+ * @param[out] p_params Pointer to the structure for the current CSMA-CA parameters.
+ */
+void nrf_802154_pib_csma_ca_params_get(nrf_802154_csma_ca_params_t * p_params);
+
+#endif // NRF_802154_CSMA_CA_ENABLED
+
 #ifdef __cplusplus
 }
 #endif
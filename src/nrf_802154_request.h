@@ -34,6 +34,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_types.h"
@@ -102,6 +103,21 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                                  bool                           immediate,
                                  nrf_802154_notification_func_t notify_function);
 
+#if NRF_802154_TX_QUEUE_ENABLED
+
+/**
+ * @brief Request transmission of a frame after the transmission in progress.
+ *
+ * @param[in]  p_data  Pointer to the frame to transmit.
+ * @param[in]  cca     If the driver is to perform the CCA procedure before transmission.
+ *
+ * @retval  true   The frame will be transmitted.
+ * @retval  false  The transmit queue is full or the driver is performing other procedure.
+ */
+bool nrf_802154_request_transmit_enqueue(const uint8_t * p_data, bool cca);
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_ED state.
  *
@@ -83,6 +83,15 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                      notify_function)
 }
 
+#if NRF_802154_TX_QUEUE_ENABLED
+
+bool nrf_802154_request_transmit_enqueue(const uint8_t * p_data, bool cca)
+{
+    REQUEST_FUNCTION(nrf_802154_core_transmit_enqueue, p_data, cca)
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
 {
     REQUEST_FUNCTION(nrf_802154_core_energy_detection, term_lvl, time_us)
@@ -36,33 +36,149 @@
 
 #include "nrf_802154_rx_buffer.h"
 
+#include <assert.h>
 #include <stddef.h>
+#include <stdint.h>
 
+#include <nrf.h>
 #include "nrf_802154_config.h"
 
 #if NRF_802154_RX_BUFFERS < 1
 #error Not enough rx buffers in the 802.15.4 radio driver.
 #endif
 
+#define BITMAP_WORD_BITS 32u ///< Number of buffers tracked by a single bitmap word.
+#define BITMAP_WORDS     ((NRF_802154_RX_BUFFERS + BITMAP_WORD_BITS - 1) / BITMAP_WORD_BITS)
+
 rx_buffer_t nrf_802154_rx_buffers[NRF_802154_RX_BUFFERS]; ///< Receive buffers.
 
+/**
+ * @brief Bitmap of buffers that may be free.
+ *
+ * Buffer with index i is represented by bit (31 - i % 32) of word i / 32, so that count leading
+ * zeros yields the lowest index first. A set bit is only a hint: the buffer is free if its
+ * @c free flag is set. Bits of buffers taken by the core are cleared lazily by
+ * @ref nrf_802154_rx_buffer_free_find.
+ */
+static volatile uint32_t m_free_bitmap[BITMAP_WORDS];
+
+/**
+ * @brief Get mask of the bit representing given buffer in its bitmap word.
+ *
+ * @param[in]  index  Index of the buffer.
+ *
+ * @return  Bit mask of the buffer.
+ */
+static inline uint32_t buffer_bit_get(uint32_t index)
+{
+    return 1UL << (BITMAP_WORD_BITS - 1 - (index % BITMAP_WORD_BITS));
+}
+
+/**
+ * @brief Atomically set bits in a bitmap word.
+ *
+ * @param[in]  p_word  Pointer to the bitmap word.
+ * @param[in]  mask    Bits to set.
+ */
+static inline void bitmap_set(volatile uint32_t * p_word, uint32_t mask)
+{
+    do
+    {
+        uint32_t value = __LDREXW(p_word);
+
+        value |= mask;
+
+        if (!__STREXW(value, p_word))
+        {
+            break;
+        }
+    }
+    while (true);
+
+    __DMB();
+}
+
+/**
+ * @brief Atomically clear bits in a bitmap word.
+ *
+ * @param[in]  p_word  Pointer to the bitmap word.
+ * @param[in]  mask    Bits to clear.
+ */
+static inline void bitmap_clear(volatile uint32_t * p_word, uint32_t mask)
+{
+    do
+    {
+        uint32_t value = __LDREXW(p_word);
+
+        value &= ~mask;
+
+        if (!__STREXW(value, p_word))
+        {
+            break;
+        }
+    }
+    while (true);
+
+    __DMB();
+}
+
 void nrf_802154_rx_buffer_init(void)
 {
+    for (uint32_t i = 0; i < BITMAP_WORDS; i++)
+    {
+        m_free_bitmap[i] = 0;
+    }
+
     for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
     {
-        nrf_802154_rx_buffers[i].free = true;
+        nrf_802154_rx_buffers[i].free        = true;
+        m_free_bitmap[i / BITMAP_WORD_BITS] |= buffer_bit_get(i);
     }
 }
 
 rx_buffer_t * nrf_802154_rx_buffer_free_find(void)
 {
-    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    for (uint32_t word = 0; word < BITMAP_WORDS; word++)
     {
-        if (nrf_802154_rx_buffers[i].free)
+        uint32_t bits = m_free_bitmap[word];
+
+        while (bits)
         {
-            return &nrf_802154_rx_buffers[i];
+            uint32_t      index    = word * BITMAP_WORD_BITS + __CLZ(bits);
+            uint32_t      mask     = buffer_bit_get(index);
+            rx_buffer_t * p_buffer = &nrf_802154_rx_buffers[index];
+
+            if (p_buffer->free)
+            {
+                return p_buffer;
+            }
+
+            // Buffer was taken since it was released. Drop the stale hint.
+            bitmap_clear(&m_free_bitmap[word], mask);
+
+            // The buffer could have been released before its bit was cleared.
+            if (p_buffer->free)
+            {
+                bitmap_set(&m_free_bitmap[word], mask);
+                return p_buffer;
+            }
+
+            bits &= ~mask;
         }
     }
 
     return NULL;
 }
+
+void nrf_802154_rx_buffer_release(rx_buffer_t * p_buffer)
+{
+    assert((p_buffer >= &nrf_802154_rx_buffers[0]) &&
+           (p_buffer < &nrf_802154_rx_buffers[NRF_802154_RX_BUFFERS]));
+
+    uint32_t index = (uint32_t)(p_buffer - nrf_802154_rx_buffers);
+
+    p_buffer->free = true;
+    __DMB();
+
+    bitmap_set(&m_free_bitmap[index / BITMAP_WORD_BITS], buffer_bit_get(index));
+}
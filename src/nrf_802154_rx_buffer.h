@@ -40,6 +40,7 @@
 #include <stdint.h>
 
 #include "nrf_802154_const.h"
+#include "mac_features/nrf_802154_frame_parser.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -50,8 +51,10 @@ extern "C" {
  */
 typedef struct
 {
-    uint8_t data[MAX_PACKET_SIZE + 1];
-    bool    free; // If this buffer is free or contains a frame.
+    uint8_t                            data[MAX_PACKET_SIZE + 1];
+    bool                               free;      // If this buffer is free or contains a frame.
+    bool                               mhr_valid; // If mhr contains the parsed MAC header.
+    nrf_802154_frame_parser_mhr_data_t mhr;       // MAC header parsed during reception.
 } rx_buffer_t;
 
 /**
@@ -71,10 +74,23 @@ void nrf_802154_rx_buffer_init(void);
 /**
  * @brief Gets a free buffer to receive a frame.
  *
+ * Free buffers are tracked in a bitmap, so the search does not depend on the number of buffers.
+ * The returned buffer stays free until the caller clears its @c free flag.
+ *
  * @returns  Pointer to a free buffer, or NULL if no free buffer is available.
  */
 rx_buffer_t * nrf_802154_rx_buffer_free_find(void);
 
+/**
+ * @brief Returns a buffer to the pool of free buffers.
+ *
+ * This function can be called from any context, including a context preempting
+ * @ref nrf_802154_rx_buffer_free_find.
+ *
+ * @param[in]  p_buffer  Pointer to the buffer that is no longer used.
+ */
+void nrf_802154_rx_buffer_release(rx_buffer_t * p_buffer);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,190 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements statistics collected by the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_stats.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
+#if NRF_802154_STATS_ENABLED
+
+static nrf_802154_stats_t m_stats;                                      ///< Collected statistics.
+static uint32_t           m_irq_start_time[NRF_802154_STATS_IRQ_ID_NUM]; ///< Time stamps of the beginning of the measured radio IRQ handler parts.
+
+/**
+ * @brief Gets the current value of the time source used for measurements.
+ *
+ * @returns Current value of the DWT cycle counter.
+ */
+static inline uint32_t timestamp_get(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief Gets the index of the histogram bin matching the given duration.
+ *
+ * @param[in]  duration  Measured duration in CPU cycles.
+ *
+ * @returns Index of the histogram bin.
+ */
+static uint32_t histogram_bin_get(uint32_t duration)
+{
+    // Index of the most significant bit set in the first bin limit.
+    const uint32_t bin0_msb = 31 - __CLZ(NRF_802154_STATS_HISTOGRAM_BIN0_LIMIT);
+    uint32_t       bin;
+
+    if (duration < NRF_802154_STATS_HISTOGRAM_BIN0_LIMIT)
+    {
+        return 0;
+    }
+
+    bin = (31 - __CLZ(duration)) - bin0_msb + 1;
+
+    return (bin < NRF_802154_STATS_HISTOGRAM_BINS) ? bin : (NRF_802154_STATS_HISTOGRAM_BINS - 1);
+}
+
+/**
+ * @brief Clears the duration statistics.
+ *
+ * @param[out]  p_duration  Pointer to the statistics to be cleared.
+ */
+static void duration_reset(nrf_802154_stats_duration_t * p_duration)
+{
+    memset(p_duration, 0, sizeof(*p_duration));
+    p_duration->min = UINT32_MAX;
+}
+
+void nrf_802154_stats_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+    nrf_802154_stats_data_reset();
+}
+
+void nrf_802154_stats_irq_enter(nrf_802154_stats_irq_id_t id)
+{
+    assert(id < NRF_802154_STATS_IRQ_ID_NUM);
+
+    m_irq_start_time[id] = timestamp_get();
+}
+
+void nrf_802154_stats_irq_exit(nrf_802154_stats_irq_id_t id)
+{
+    assert(id < NRF_802154_STATS_IRQ_ID_NUM);
+
+    nrf_802154_stats_irq_duration_add(id, timestamp_get() - m_irq_start_time[id]);
+}
+
+void nrf_802154_stats_irq_duration_add(nrf_802154_stats_irq_id_t id, uint32_t duration)
+{
+    nrf_802154_stats_duration_t * p_duration;
+
+    assert(id < NRF_802154_STATS_IRQ_ID_NUM);
+
+    p_duration = &m_stats.irq[id];
+
+    p_duration->count++;
+    p_duration->histogram[histogram_bin_get(duration)]++;
+
+    if (duration < p_duration->min)
+    {
+        p_duration->min = duration;
+    }
+
+    if (duration > p_duration->max)
+    {
+        p_duration->max = duration;
+    }
+}
+
+void nrf_802154_stats_timer_sched_fired_add(uint32_t timers_fired)
+{
+    nrf_802154_stats_timer_sched_t * p_timer_sched = &m_stats.timer_sched;
+
+    p_timer_sched->fired_irqs++;
+    p_timer_sched->fired_timers += timers_fired;
+
+    if (timers_fired > p_timer_sched->fired_max)
+    {
+        p_timer_sched->fired_max = timers_fired;
+    }
+}
+
+void nrf_802154_stats_ack_add(bool deadline_met)
+{
+    if (deadline_met)
+    {
+        m_stats.ack.sent++;
+    }
+    else
+    {
+        m_stats.ack.missed++;
+    }
+}
+
+void nrf_802154_stats_data_get(nrf_802154_stats_t * p_stats)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    *p_stats = m_stats;
+    __set_PRIMASK(primask);
+}
+
+void nrf_802154_stats_data_reset(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    memset(&m_stats, 0, sizeof(m_stats));
+
+    for (uint32_t i = 0; i < NRF_802154_STATS_IRQ_ID_NUM; i++)
+    {
+        duration_reset(&m_stats.irq[i]);
+    }
+
+    __set_PRIMASK(primask);
+}
+
+#endif // NRF_802154_STATS_ENABLED
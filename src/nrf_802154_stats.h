@@ -0,0 +1,121 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that collects statistics of the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_STATS_H__
+#define NRF_802154_STATS_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_stats Statistics collected by the 802.15.4 driver
+ * @{
+ * @ingroup nrf_802154
+ * @brief Statistics collected by the 802.15.4 driver.
+ */
+
+#if NRF_802154_STATS_ENABLED
+
+/**
+ * @brief Initializes the statistics module and the time source used for measurements.
+ */
+void nrf_802154_stats_init(void);
+
+/**
+ * @brief Marks the beginning of the measured radio IRQ handler part.
+ *
+ * @param[in]  id  Identifier of the radio IRQ handler part.
+ */
+void nrf_802154_stats_irq_enter(nrf_802154_stats_irq_id_t id);
+
+/**
+ * @brief Marks the end of the measured radio IRQ handler part and updates its statistics.
+ *
+ * @param[in]  id  Identifier of the radio IRQ handler part.
+ */
+void nrf_802154_stats_irq_exit(nrf_802154_stats_irq_id_t id);
+
+/**
+ * @brief Adds a duration measurement of the radio IRQ handler part.
+ *
+ * @param[in]  id        Identifier of the radio IRQ handler part.
+ * @param[in]  duration  Measured duration in CPU cycles.
+ */
+void nrf_802154_stats_irq_duration_add(nrf_802154_stats_irq_id_t id, uint32_t duration);
+
+/**
+ * @brief Records timers fired in a single low power timer interrupt.
+ *
+ * @param[in]  timers_fired  Number of timers fired in the interrupt.
+ */
+void nrf_802154_stats_timer_sched_fired_add(uint32_t timers_fired);
+
+/**
+ * @brief Records an ACK frame for which transmission was being triggered.
+ *
+ * @param[in]  deadline_met  If the transmission of the ACK frame was triggered in time.
+ */
+void nrf_802154_stats_ack_add(bool deadline_met);
+
+/**
+ * @brief Gets a consistent copy of the collected statistics.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled with the statistics.
+ */
+void nrf_802154_stats_data_get(nrf_802154_stats_t * p_stats);
+
+/**
+ * @brief Clears the collected statistics.
+ */
+void nrf_802154_stats_data_reset(void);
+
+#else // NRF_802154_STATS_ENABLED
+
+#define nrf_802154_stats_init()
+#define nrf_802154_stats_irq_enter(id)
+#define nrf_802154_stats_irq_exit(id)
+#define nrf_802154_stats_timer_sched_fired_add(timers_fired)
+#define nrf_802154_stats_ack_add(deadline_met)
+
+#endif // NRF_802154_STATS_ENABLED
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_STATS_H__
@@ -38,6 +38,7 @@
 
 #include <assert.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "nrf_802154.h"
@@ -48,6 +49,7 @@
 #include "nrf_802154_utils.h"
 #include "nrf_egu.h"
 #include "platform/clock/nrf_802154_clock.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
 
 /** Size of notification queue.
  *
@@ -58,9 +60,27 @@
 
 /** Size of requests queue.
  *
- * Two is minimal queue size. It is not expected in current implementation to queue a few requests.
+ * Each request in progress occupies one slot until the SWI processes it, so the queue size is
+ * the number of request functions that may be in progress at the same time.
  */
-#define REQ_QUEUE_SIZE     2
+#define REQ_QUEUE_SIZE     NRF_802154_SWI_REQ_QUEUE_SIZE
+
+#if REQ_QUEUE_SIZE < 1
+#error NRF_802154_SWI_REQ_QUEUE_SIZE must be at least 1.
+#endif
+
+#if NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+
+#if !NRF_802154_USE_RAW_API
+#error NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED requires NRF_802154_USE_RAW_API.
+#endif
+
+#if (NRF_802154_NOTIFY_RECEIVED_BATCH_THRESHOLD < 1) || \
+    (NRF_802154_NOTIFY_RECEIVED_BATCH_THRESHOLD > NRF_802154_RX_BUFFERS)
+#error NRF_802154_NOTIFY_RECEIVED_BATCH_THRESHOLD must be in range 1 to NRF_802154_RX_BUFFERS.
+#endif
+
+#endif // NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
 
 #define SWI_EGU            NRF_802154_SWI_EGU_INSTANCE ///< Label of SWI peripheral.
 #define SWI_IRQn           NRF_802154_SWI_IRQN         ///< Symbol of SWI IRQ number.
@@ -155,6 +175,9 @@ typedef enum
     REQ_TYPE_SLEEP,
     REQ_TYPE_RECEIVE,
     REQ_TYPE_TRANSMIT,
+#if NRF_802154_TX_QUEUE_ENABLED
+    REQ_TYPE_TRANSMIT_ENQUEUE,
+#endif // NRF_802154_TX_QUEUE_ENABLED
     REQ_TYPE_ENERGY_DETECTION,
     REQ_TYPE_CCA,
     REQ_TYPE_CONTINUOUS_CARRIER,
@@ -165,10 +188,19 @@ typedef enum
     REQ_TYPE_RSSI_GET,
 } nrf_802154_req_type_t;
 
+/// States of slots in request queue.
+typedef enum
+{
+    REQ_SLOT_STATE_FREE,     ///< Slot is free.
+    REQ_SLOT_STATE_RESERVED, ///< Slot is reserved by a request function that fills it.
+    REQ_SLOT_STATE_READY,    ///< Slot contains a request ready to be processed.
+} nrf_802154_req_slot_state_t;
+
 /// Request data in request queue.
 typedef struct
 {
-    nrf_802154_req_type_t type; ///< Type of the request.
+    volatile uint8_t      state; ///< State of the slot, one of @ref nrf_802154_req_slot_state_t.
+    nrf_802154_req_type_t type;  ///< Type of the request.
 
     union
     {
@@ -198,6 +230,15 @@ typedef struct
             bool                         * p_result;   ///< Transmit request result.
         } transmit;                                    ///< Transmit request details.
 
+#if NRF_802154_TX_QUEUE_ENABLED
+        struct
+        {
+            const uint8_t * p_data;   ///< Pointer to a buffer containing PHR and PSDU of the frame to transmit.
+            bool            cca;      ///< If CCA was requested prior to transmission.
+            bool          * p_result; ///< Transmit enqueue request result.
+        } transmit_enqueue;           ///< Transmit enqueue request details.
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
         struct
         {
             nrf_802154_term_t term_lvl; ///< Request priority.
@@ -251,8 +292,13 @@ static uint8_t               m_ntf_r_ptr;                 ///< Notification queu
 static uint8_t               m_ntf_w_ptr;                 ///< Notification queue write index.
 
 static nrf_802154_req_data_t m_req_queue[REQ_QUEUE_SIZE]; ///< Request queue.
-static uint8_t               m_req_r_ptr;                 ///< Request queue read index.
-static uint8_t               m_req_w_ptr;                 ///< Request queue write index.
+
+#if NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+static nrf_802154_received_frame_t m_rx_batch[NRF_802154_RX_BUFFERS]; ///< Received frames delivered in a single batch.
+static uint32_t                    m_rx_batch_count;                  ///< Number of frames in the batch.
+static volatile uint8_t            m_rx_batch_pending;                ///< Number of received frames queued since the last batch delivery started.
+static nrf_802154_timer_t          m_rx_batch_timer;                  ///< Timer limiting the time a received frame waits for the batch delivery.
+#endif // NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
 
 /**
  * Increment given index for any queue.
@@ -374,71 +420,173 @@ static void ntf_exit(void)
     __enable_irq();
 }
 
+#if NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+
 /**
- * Increment given index associated with request queue.
+ * Callback of the timer limiting the time a received frame waits for the batch delivery.
  *
- * @param[inout]  p_ptr  Pointer to the index to increment.
+ * @param[in]  p_context  Unused.
  */
-static void req_queue_ptr_increment(uint8_t * p_ptr)
+static void rx_batch_timer_fired(void * p_context)
 {
-    queue_ptr_increment(p_ptr, REQ_QUEUE_SIZE);
+    (void)p_context;
+
+    nrf_egu_task_trigger(SWI_EGU, NTF_TASK);
 }
 
 /**
- * Check if request queue is full.
+ * Exit notify block of a received frame.
  *
- * @retval  true   Request queue is full.
- * @retval  false  Request queue is not full.
+ * This function works like @ref ntf_exit, but it triggers SWI only if the number of received
+ * frames waiting in the notification queue reaches the batch threshold. The first frame
+ * of a batch starts the timer that limits the delay of the batch delivery instead.
  */
-static bool req_queue_is_full(void)
+static void ntf_received_exit(void)
 {
-    return queue_is_full(m_req_r_ptr, m_req_w_ptr, REQ_QUEUE_SIZE);
+    uint8_t pending = m_rx_batch_pending + 1;
+    bool    trigger = (pending >= NRF_802154_NOTIFY_RECEIVED_BATCH_THRESHOLD);
+
+    m_rx_batch_pending = pending;
+    ntf_queue_ptr_increment(&m_ntf_w_ptr);
+
+    if (trigger)
+    {
+        nrf_egu_task_trigger(SWI_EGU, NTF_TASK);
+    }
+
+    __enable_irq();
+
+    if (!trigger && (pending == 1))
+    {
+        m_rx_batch_timer.callback  = rx_batch_timer_fired;
+        m_rx_batch_timer.p_context = NULL;
+        m_rx_batch_timer.t0        = nrf_802154_timer_sched_time_get();
+        m_rx_batch_timer.dt        = NRF_802154_NOTIFY_RECEIVED_BATCH_TIMEOUT;
+
+        nrf_802154_timer_sched_add(&m_rx_batch_timer, false);
+    }
 }
 
 /**
- * Check if request queue is empty.
+ * Start delivery of the received frames batch.
  *
- * @retval  true   Request queue is empty.
- * @retval  false  Request queue is not empty.
+ * Frames received from now on are counted towards the next batch. This function must be called
+ * before the notification queue is drained, so that no frame is left in the queue without
+ * a pending SWI trigger or a running batch timer.
+ */
+static void rx_batch_delivery_start(void)
+{
+    if (m_rx_batch_pending != 0)
+    {
+        nrf_802154_timer_sched_remove(&m_rx_batch_timer, NULL);
+        m_rx_batch_pending = 0;
+    }
+}
+
+/**
+ * Deliver frames collected in the batch to the higher layer.
  */
-static bool req_queue_is_empty(void)
+static void rx_batch_flush(void)
 {
-    return queue_is_empty(m_req_r_ptr, m_req_w_ptr);
+    if (m_rx_batch_count != 0)
+    {
+        nrf_802154_received_batch_raw(m_rx_batch, m_rx_batch_count);
+        m_rx_batch_count = 0;
+    }
+}
+
+/**
+ * Append a received frame to the batch.
+ *
+ * @param[in]  p_slot  Pointer to the notification queue slot of the received frame.
+ */
+static void rx_batch_append(const nrf_802154_ntf_data_t * p_slot)
+{
+    nrf_802154_received_frame_t * p_frame = &m_rx_batch[m_rx_batch_count];
+
+    p_frame->p_data = p_slot->data.received.p_data;
+    p_frame->power  = p_slot->data.received.power;
+    p_frame->lqi    = p_slot->data.received.lqi;
+
+    if (++m_rx_batch_count == NRF_802154_RX_BUFFERS)
+    {
+        rx_batch_flush();
+    }
+}
+
+#endif // NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+
+/**
+ * Try to reserve given slot of the request queue.
+ *
+ * @param[inout]  p_slot  Pointer to the slot to reserve.
+ *
+ * @retval  true   The slot was free and is now reserved.
+ * @retval  false  The slot is used by another request.
+ */
+static bool req_slot_reserve(nrf_802154_req_data_t * p_slot)
+{
+    do
+    {
+        uint8_t state = __LDREXB(&p_slot->state);
+
+        if (state != REQ_SLOT_STATE_FREE)
+        {
+            __CLREX();
+
+            return false;
+        }
+    }
+    while (__STREXB(REQ_SLOT_STATE_RESERVED, &p_slot->state));
+
+    return true;
 }
 
 /**
  * Enter request block.
  *
- * This is a helper function used in all request functions to atomically
- * find an empty slot in request queue and allow atomic slot update.
+ * This is a helper function used in all request functions to atomically reserve a free slot
+ * in request queue. The slot is reserved without disabling interrupts, so request functions
+ * may be called concurrently from contexts of different priorities.
  *
- * @return Pointer to an empty slot in the request queue.
+ * Any free slot may be reserved. A slot is freed as soon as its request is processed, so
+ * a request function preempted while it holds a slot does not keep other slots from being
+ * reused.
+ *
+ * @return Pointer to a reserved slot in the request queue.
  */
 static nrf_802154_req_data_t * req_enter(void)
 {
-    __disable_irq();
-    __DSB();
-    __ISB();
+    for (uint32_t i = 0; i < REQ_QUEUE_SIZE; i++)
+    {
+        if (req_slot_reserve(&m_req_queue[i]))
+        {
+            return &m_req_queue[i];
+        }
+    }
 
-    assert(!req_queue_is_full());
-    (void)req_queue_is_full();
+    // More request functions are in progress than NRF_802154_SWI_REQ_QUEUE_SIZE allows.
+    assert(false);
 
-    return &m_req_queue[m_req_w_ptr];
+    return NULL;
 }
 
 /**
  * Exit request block.
  *
- * This is a helper function used in all request functions to end atomic slot update
+ * This is a helper function used in all request functions to publish the filled slot
  * and trigger SWI to process the request from the slot.
+ *
+ * @param[in]  p_slot  Pointer to the slot returned by @ref req_enter.
  */
-static void req_exit(void)
+static void req_exit(nrf_802154_req_data_t * p_slot)
 {
-    req_queue_ptr_increment(&m_req_w_ptr);
+    // Make sure the request data is stored before the slot is marked as ready.
+    __DMB();
+    p_slot->state = REQ_SLOT_STATE_READY;
 
     nrf_egu_task_trigger(SWI_EGU, REQ_TASK);
 
-    __enable_irq();
     __DSB();
     __ISB();
 }
@@ -467,7 +615,11 @@ void nrf_802154_swi_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
     p_slot->data.received.power  = power;
     p_slot->data.received.lqi    = lqi;
 
+#if NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+    ntf_received_exit();
+#else
     ntf_exit();
+#endif
 }
 
 void nrf_802154_swi_notify_receive_failed(nrf_802154_rx_error_t error)
@@ -567,7 +719,7 @@ void nrf_802154_swi_sleep(nrf_802154_term_t term_lvl, bool * p_result)
     p_slot->data.sleep.term_lvl = term_lvl;
     p_slot->data.sleep.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_receive(nrf_802154_term_t              term_lvl,
@@ -585,7 +737,7 @@ void nrf_802154_swi_receive(nrf_802154_term_t              term_lvl,
     p_slot->data.receive.notif_abort = notify_abort;
     p_slot->data.receive.p_result    = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_transmit(nrf_802154_term_t              term_lvl,
@@ -607,9 +759,25 @@ void nrf_802154_swi_transmit(nrf_802154_term_t              term_lvl,
     p_slot->data.transmit.notif_func = notify_function;
     p_slot->data.transmit.p_result   = p_result;
 
-    req_exit();
+    req_exit(p_slot);
+}
+
+#if NRF_802154_TX_QUEUE_ENABLED
+
+void nrf_802154_swi_transmit_enqueue(const uint8_t * p_data, bool cca, bool * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter();
+
+    p_slot->type                           = REQ_TYPE_TRANSMIT_ENQUEUE;
+    p_slot->data.transmit_enqueue.p_data   = p_data;
+    p_slot->data.transmit_enqueue.cca      = cca;
+    p_slot->data.transmit_enqueue.p_result = p_result;
+
+    req_exit(p_slot);
 }
 
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
 void nrf_802154_swi_energy_detection(nrf_802154_term_t term_lvl,
                                      uint32_t          time_us,
                                      bool            * p_result)
@@ -621,7 +789,7 @@ void nrf_802154_swi_energy_detection(nrf_802154_term_t term_lvl,
     p_slot->data.energy_detection.time_us  = time_us;
     p_slot->data.energy_detection.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_cca(nrf_802154_term_t term_lvl, bool * p_result)
@@ -632,7 +800,7 @@ void nrf_802154_swi_cca(nrf_802154_term_t term_lvl, bool * p_result)
     p_slot->data.cca.term_lvl = term_lvl;
     p_slot->data.cca.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_continuous_carrier(nrf_802154_term_t term_lvl, bool * p_result)
@@ -643,7 +811,7 @@ void nrf_802154_swi_continuous_carrier(nrf_802154_term_t term_lvl, bool * p_resu
     p_slot->data.continuous_carrier.term_lvl = term_lvl;
     p_slot->data.continuous_carrier.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_buffer_free(uint8_t * p_data, bool * p_result)
@@ -654,7 +822,7 @@ void nrf_802154_swi_buffer_free(uint8_t * p_data, bool * p_result)
     p_slot->data.buffer_free.p_data   = p_data;
     p_slot->data.buffer_free.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_channel_update(bool * p_result)
@@ -664,7 +832,7 @@ void nrf_802154_swi_channel_update(bool * p_result)
     p_slot->type                         = REQ_TYPE_CHANNEL_UPDATE;
     p_slot->data.channel_update.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_cca_cfg_update(bool * p_result)
@@ -674,7 +842,7 @@ void nrf_802154_swi_cca_cfg_update(bool * p_result)
     p_slot->type                         = REQ_TYPE_CCA_CFG_UPDATE;
     p_slot->data.cca_cfg_update.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_rssi_measure(bool * p_result)
@@ -684,7 +852,7 @@ void nrf_802154_swi_rssi_measure(bool * p_result)
     p_slot->type                       = REQ_TYPE_RSSI_MEASURE;
     p_slot->data.rssi_measure.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_rssi_measurement_get(int8_t * p_rssi, bool * p_result)
@@ -695,7 +863,7 @@ void nrf_802154_swi_rssi_measurement_get(int8_t * p_rssi, bool * p_result)
     p_slot->data.rssi_get.p_rssi   = p_rssi;
     p_slot->data.rssi_get.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void SWI_IRQHandler(void)
@@ -704,14 +872,28 @@ void SWI_IRQHandler(void)
     {
         nrf_egu_event_clear(SWI_EGU, NTF_EVENT);
 
+#if NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+        rx_batch_delivery_start();
+#endif
+
         while (!ntf_queue_is_empty())
         {
             nrf_802154_ntf_data_t * p_slot = &m_ntf_queue[m_ntf_r_ptr];
 
+#if NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+            // Frames received before any other notification are delivered first to keep order.
+            if (p_slot->type != NTF_TYPE_RECEIVED)
+            {
+                rx_batch_flush();
+            }
+#endif
+
             switch (p_slot->type)
             {
                 case NTF_TYPE_RECEIVED:
-#if NRF_802154_USE_RAW_API
+#if NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+                    rx_batch_append(p_slot);
+#elif NRF_802154_USE_RAW_API
                     nrf_802154_received_raw(p_slot->data.received.p_data,
                                             p_slot->data.received.power,
                                             p_slot->data.received.lqi);
@@ -777,6 +959,10 @@ void SWI_IRQHandler(void)
 
             ntf_queue_ptr_increment(&m_ntf_r_ptr);
         }
+
+#if NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+        rx_batch_flush();
+#endif
     }
 
     if (nrf_egu_event_check(SWI_EGU, HFCLK_STOP_EVENT))
@@ -790,9 +976,17 @@ void SWI_IRQHandler(void)
     {
         nrf_egu_event_clear(SWI_EGU, REQ_EVENT);
 
-        while (!req_queue_is_empty())
+        // A request function preempted between reserving and filling its slot holds a slot that
+        // is not ready yet. The ready requests are processed anyway to prevent priority
+        // inversion. The preempted request is processed when its slot is published.
+        for (uint32_t i = 0; i < REQ_QUEUE_SIZE; i++)
         {
-            nrf_802154_req_data_t * p_slot = &m_req_queue[m_req_r_ptr];
+            nrf_802154_req_data_t * p_slot = &m_req_queue[i];
+
+            if (p_slot->state != REQ_SLOT_STATE_READY)
+            {
+                continue;
+            }
 
             switch (p_slot->type)
             {
@@ -819,6 +1013,14 @@ void SWI_IRQHandler(void)
                                                  p_slot->data.transmit.notif_func);
                     break;
 
+#if NRF_802154_TX_QUEUE_ENABLED
+                case REQ_TYPE_TRANSMIT_ENQUEUE:
+                    *(p_slot->data.transmit_enqueue.p_result) =
+                        nrf_802154_core_transmit_enqueue(p_slot->data.transmit_enqueue.p_data,
+                                                         p_slot->data.transmit_enqueue.cca);
+                    break;
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
                 case REQ_TYPE_ENERGY_DETECTION:
                     *(p_slot->data.energy_detection.p_result) =
                         nrf_802154_core_energy_detection(
@@ -862,7 +1064,9 @@ void SWI_IRQHandler(void)
                     assert(false);
             }
 
-            req_queue_ptr_increment(&m_req_r_ptr);
+            // Make sure the request is processed before the slot can be reserved again.
+            __DMB();
+            p_slot->state = REQ_SLOT_STATE_FREE;
         }
     }
 }
@@ -197,6 +197,20 @@ void nrf_802154_swi_transmit(nrf_802154_term_t              term_lvl,
                              nrf_802154_notification_func_t notify_function,
                              bool                         * p_result);
 
+#if NRF_802154_TX_QUEUE_ENABLED
+
+/**
+ * @brief Requests transmission of a frame after the transmission in progress from the SWI priority.
+ *
+ * @param[in]   p_data    Pointer to a buffer that contains PHR and PSDU of the frame to be
+ *                        transmitted.
+ * @param[in]   cca       If the driver should perform the CCA procedure before transmission.
+ * @param[out]  p_result  Result of the request.
+ */
+void nrf_802154_swi_transmit_enqueue(const uint8_t * p_data, bool cca, bool * p_result);
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_ED state from the SWI priority.
  *
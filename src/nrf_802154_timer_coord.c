@@ -142,24 +142,33 @@ void nrf_802154_timer_coord_timestamp_prepare(uint32_t event_addr)
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TCOOR_TIMESTAMP_PREPARE);
 }
 
+/**
+ * @brief Converts the HP timer time to the LP timer time base.
+ *
+ * @param[in]  hp_time  HP timer time to convert.
+ *
+ * @returns  Time in the LP timer time base [us].
+ */
+static uint32_t hp_time_to_lp_time(uint32_t hp_time)
+{
+    uint32_t hp_delta = hp_time - m_last_sync.hp_timer_time;
+    int32_t  drift    = m_drift_known ?
+                        (DIV_ROUND(((int64_t)m_drift * hp_delta), ((int64_t)TIME_BASE + m_drift))) :
+                        0;
+
+    return m_last_sync.lp_timer_time + hp_delta - drift;
+}
+
 bool nrf_802154_timer_coord_timestamp_get(uint32_t * p_timestamp)
 {
-    uint32_t hp_timestamp;
-    uint32_t hp_delta;
-    int32_t  drift;
-    bool     result = false;
+    bool result = false;
 
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TCOOR_TIMESTAMP_GET);
     assert(p_timestamp != NULL);
 
     if (m_synchronized)
     {
-        hp_timestamp = nrf_802154_hp_timer_timestamp_get();
-        hp_delta     = hp_timestamp - m_last_sync.hp_timer_time;
-        drift        = m_drift_known ?
-                       (DIV_ROUND(((int64_t)m_drift * hp_delta), ((int64_t)TIME_BASE + m_drift))) :
-                       0;
-        *p_timestamp = m_last_sync.lp_timer_time + hp_delta - drift;
+        *p_timestamp = hp_time_to_lp_time(nrf_802154_hp_timer_timestamp_get());
         result       = true;
     }
 
@@ -167,6 +176,21 @@ bool nrf_802154_timer_coord_timestamp_get(uint32_t * p_timestamp)
     return result;
 }
 
+bool nrf_802154_timer_coord_time_get(uint32_t * p_time)
+{
+    bool result = false;
+
+    assert(p_time != NULL);
+
+    if (m_synchronized)
+    {
+        *p_time = hp_time_to_lp_time(nrf_802154_hp_timer_current_time_get());
+        result  = true;
+    }
+
+    return result;
+}
+
 void nrf_802154_lp_timer_synchronized(void)
 {
     common_timepoint_t sync_time;
@@ -265,4 +289,13 @@ bool nrf_802154_timer_coord_timestamp_get(uint32_t * p_timestamp)
     return false;
 }
 
+bool nrf_802154_timer_coord_time_get(uint32_t * p_time)
+{
+    (void)p_time;
+
+    // Intentionally empty
+
+    return false;
+}
+
 #endif // NRF_802154_FRAME_TIMESTAMP_ENABLED
@@ -106,6 +106,20 @@ void nrf_802154_timer_coord_timestamp_prepare(uint32_t event_addr);
  */
 bool nrf_802154_timer_coord_timestamp_get(uint32_t * p_timestamp);
 
+/**
+ * @brief Gets the current time with the precision of the HP timer.
+ *
+ * The returned time uses the same time base as the LP timer, so it can be compared with
+ * the timestamps used by the Timer Scheduler. This function is to be called only when the Timer
+ * Coordinator is started. If the HP timer is not synchronized yet, this function returns false.
+ *
+ * @param[out]  p_time  Precise absolute current time, in microseconds (us).
+ *
+ * @retval true   Current time is available.
+ * @retval false  Current time is unavailable.
+ */
+bool nrf_802154_timer_coord_time_get(uint32_t * p_time);
+
 /**
  *@}
  **/
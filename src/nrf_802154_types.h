@@ -130,6 +130,16 @@ typedef struct
     uint8_t              corr_limit;     // !< Limit of occurrences above the busy threshold of the CCA correlator. Not used in NRF_RADIO_CCA_MODE_ED.
 } nrf_802154_cca_cfg_t;
 
+/**
+ * @brief Structure for configuring the CSMA-CA procedure.
+ */
+typedef struct
+{
+    uint8_t min_be;            // !< Minimum value of the backoff exponent (macMinBe).
+    uint8_t max_be;            // !< Maximum value of the backoff exponent (macMaxBe).
+    uint8_t max_csma_backoffs; // !< Maximum number of backoffs before a channel access failure is reported (macMaxCsmaBackoffs).
+} nrf_802154_csma_ca_params_t;
+
 /**
  * @brief Types of data that can be set in an ACK message.
  */
@@ -155,6 +165,150 @@ typedef uint8_t nrf_802154_src_addr_match_t;
 #define NRF_802154_SRC_ADDR_MATCH_ZIGBEE   0x01 // !< Implementation for the Zigbee protocol.
 #define NRF_802154_SRC_ADDR_MATCH_ALWAYS_1 0x02 // !< Standard compliant implementation.
 
+/**
+ * @brief Descriptor of a received frame delivered in a batch.
+ *
+ * @sa nrf_802154_received_batch_raw
+ */
+typedef struct
+{
+    uint8_t * p_data; // !< Pointer to a buffer that contains PHR and PSDU of the received frame.
+    int8_t    power;  // !< RSSI of the received frame.
+    uint8_t   lqi;    // !< LQI of the received frame.
+} nrf_802154_received_frame_t;
+
+/**
+ * @brief Identifiers of the radio IRQ handler parts for which duration statistics are collected.
+ */
+typedef uint8_t nrf_802154_stats_irq_id_t;
+
+#define NRF_802154_STATS_IRQ_ID_HANDLER  0x00 // !< Whole radio IRQ handler.
+#define NRF_802154_STATS_IRQ_ID_ADDRESS  0x01 // !< Handling of the ADDRESS event.
+#define NRF_802154_STATS_IRQ_ID_BCMATCH  0x02 // !< Handling of the BCMATCH event.
+#define NRF_802154_STATS_IRQ_ID_CRCERROR 0x03 // !< Handling of the CRCERROR event.
+#define NRF_802154_STATS_IRQ_ID_CRCOK    0x04 // !< Handling of the CRCOK event.
+#define NRF_802154_STATS_IRQ_ID_PHYEND   0x05 // !< Handling of the PHYEND event.
+#define NRF_802154_STATS_IRQ_ID_END      0x06 // !< Handling of the END event.
+#define NRF_802154_STATS_IRQ_ID_DISABLED 0x07 // !< Handling of the DISABLED event.
+#define NRF_802154_STATS_IRQ_ID_CCAIDLE  0x08 // !< Handling of the CCAIDLE event.
+#define NRF_802154_STATS_IRQ_ID_CCABUSY  0x09 // !< Handling of the CCABUSY event.
+#define NRF_802154_STATS_IRQ_ID_EDEND    0x0A // !< Handling of the EDEND event.
+#define NRF_802154_STATS_IRQ_ID_NUM      0x0B // !< Number of the radio IRQ handler parts.
+
+/**
+ * @brief Number of bins in the duration histogram.
+ *
+ * The first bin counts durations shorter than @ref NRF_802154_STATS_HISTOGRAM_BIN0_LIMIT CPU
+ * cycles. Each following bin covers a range twice as wide as the previous one. The last bin counts
+ * all durations that do not fit in the other bins.
+ */
+#define NRF_802154_STATS_HISTOGRAM_BINS      8
+
+/**
+ * @brief Upper limit of the first bin in the duration histogram, in CPU cycles.
+ */
+#define NRF_802154_STATS_HISTOGRAM_BIN0_LIMIT 128
+
+/**
+ * @brief Duration statistics of a measured code section.
+ */
+typedef struct
+{
+    uint32_t count;                                      // !< Number of measurements.
+    uint32_t min;                                        // !< Shortest measured duration in CPU cycles.
+    uint32_t max;                                        // !< Longest measured duration in CPU cycles.
+    uint32_t histogram[NRF_802154_STATS_HISTOGRAM_BINS]; // !< Number of measurements in each duration range.
+} nrf_802154_stats_duration_t;
+
+/**
+ * @brief Statistics of the timer scheduler.
+ */
+typedef struct
+{
+    uint32_t fired_irqs;   // !< Number of low power timer interrupts handled by the timer scheduler.
+    uint32_t fired_timers; // !< Number of timers fired.
+    uint32_t fired_max;    // !< Largest number of timers fired in a single low power timer interrupt.
+} nrf_802154_stats_timer_sched_t;
+
+/**
+ * @brief Statistics of the transmitted ACK frames.
+ */
+typedef struct
+{
+    uint32_t sent;   // !< Number of ACK frames whose transmission was triggered in time.
+    uint32_t missed; // !< Number of ACK frames dropped because their transmission could not be triggered in time.
+} nrf_802154_stats_ack_t;
+
+/**
+ * @brief Statistics collected by the driver.
+ */
+typedef struct
+{
+    nrf_802154_stats_duration_t    irq[NRF_802154_STATS_IRQ_ID_NUM]; // !< Durations of the radio IRQ handler parts, indexed by @ref nrf_802154_stats_irq_id_t.
+    nrf_802154_stats_timer_sched_t timer_sched;                      // !< Timer scheduler statistics.
+    nrf_802154_stats_ack_t         ack;                              // !< Statistics of the transmitted ACK frames.
+} nrf_802154_stats_t;
+
+/**
+ * @brief Number of bins of the setup time histogram of delayed operations.
+ */
+#define NRF_802154_SETUP_TIME_HISTOGRAM_BINS      64
+
+/**
+ * @brief Width of a single bin of the setup time histogram of delayed operations [us].
+ */
+#define NRF_802154_SETUP_TIME_HISTOGRAM_BIN_WIDTH 8
+
+/**
+ * @brief Setup time of delayed operations measured by the driver.
+ *
+ * The setup time is the time from the requested start of the timeslot of a delayed operation
+ * to the moment the radio ramp-up is started.
+ */
+typedef struct
+{
+    uint32_t setup_time;                                     // !< Setup time currently used to schedule delayed operations [us].
+    uint32_t samples;                                        // !< Number of measurements represented in the histogram.
+    uint32_t max;                                            // !< Longest measured setup time [us].
+    uint16_t histogram[NRF_802154_SETUP_TIME_HISTOGRAM_BINS]; // !< Number of measurements in consecutive ranges of @ref NRF_802154_SETUP_TIME_HISTOGRAM_BIN_WIDTH us. The last bin counts all longer measurements.
+} nrf_802154_setup_time_t;
+
+/**
+ * @brief Delays of ACK frames measured by the ACK timeout feature.
+ */
+typedef struct
+{
+    uint32_t timeout; // !< Time after the end of a transmitted frame in which the ACK must start [us].
+    uint32_t samples; // !< Number of measured ACK delays.
+    uint32_t min;     // !< Shortest measured delay between the end of a frame and the start of the ACK [us].
+    uint32_t max;     // !< Longest measured delay between the end of a frame and the start of the ACK [us].
+} nrf_802154_ack_delay_t;
+
+/**
+ * @brief Statistics of the ACK timeout feature.
+ */
+typedef struct
+{
+    nrf_802154_ack_delay_t imm_ack;  // !< Delays of Imm-Acks, received for frames of version 2006 or older.
+    nrf_802154_ack_delay_t enh_ack;  // !< Delays of Enh-Acks, received for frames of version 2015.
+    uint32_t               timeouts; // !< Number of transmissions that ended with ACK timeout.
+} nrf_802154_ack_timeout_stats_t;
+
+/**
+ * @brief Pointers to the fields of a MAC header and details of its structure.
+ */
+typedef struct
+{
+    const uint8_t * p_dst_panid;           // !< Pointer to the destination PAN ID field, or NULL if missing.
+    const uint8_t * p_dst_addr;            // !< Pointer to the destination address field, or NULL if missing.
+    const uint8_t * p_src_panid;           // !< Pointer to the source PAN ID field, or NULL if missing.
+    const uint8_t * p_src_addr;            // !< Pointer to the source address field, or NULL if missing.
+    const uint8_t * p_sec_ctrl;            // !< Pointer to the security control field, or NULL if missing.
+    uint8_t         dst_addr_size;         // !< Size of the destination address field.
+    uint8_t         src_addr_size;         // !< Size of the source address field.
+    uint8_t         addressing_end_offset; // !< Offset of the first byte following addressing fields.
+} nrf_802154_frame_parser_mhr_data_t;
+
 /**
  * @brief RSSI measurement results.
  */
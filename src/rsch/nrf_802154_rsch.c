@@ -453,9 +453,7 @@ bool nrf_802154_rsch_delayed_timeslot_request(uint32_t         t0,
         p_dly_ts->timer.callback  = delayed_timeslot_prec_request;
         p_dly_ts->timer.p_context = (void *)dly_ts_id;
 
-        nrf_802154_timer_sched_add(&p_dly_ts->timer, false);
-
-        result = true;
+        result = nrf_802154_timer_sched_add(&p_dly_ts->timer, false);
     }
     else if (requested_prio_lvl_is_at_least(RSCH_PRIO_MAX) &&
              nrf_802154_timer_sched_time_is_in_future(now, t0, dt))
@@ -469,15 +467,18 @@ bool nrf_802154_rsch_delayed_timeslot_request(uint32_t         t0,
         p_dly_ts->timer.callback  = delayed_timeslot_start;
         p_dly_ts->timer.p_context = (void *)dly_ts_id;
 
-        nrf_802154_timer_sched_add(&p_dly_ts->timer, true);
-
-        result = true;
+        result = nrf_802154_timer_sched_add(&p_dly_ts->timer, true);
     }
     else
     {
         result = false;
     }
 
+    if (!result)
+    {
+        p_dly_ts->prio = RSCH_PRIO_IDLE;
+    }
+
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_RSCH_DELAYED_TIMESLOT_REQ);
 
     return result;
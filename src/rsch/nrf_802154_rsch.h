@@ -39,6 +39,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -85,13 +87,16 @@ typedef enum
 
 /**
  * @brief Enumeration of the delayed timeslot IDs.
+ *
+ * Delayed TX operations use IDs from @ref RSCH_DLY_TX to @ref RSCH_DLY_RX - 1, and delayed RX
+ * operations use IDs from @ref RSCH_DLY_RX to @ref RSCH_DLY_TS_NUM - 1.
  */
 typedef enum
 {
-    RSCH_DLY_TX,     ///< Timeslot for delayed TX operation.
-    RSCH_DLY_RX,     ///< Timeslot for delayed RX operation.
+    RSCH_DLY_TX,                                                     ///< First timeslot for delayed TX operations.
+    RSCH_DLY_RX     = RSCH_DLY_TX + NRF_802154_DELAYED_TRX_TX_SLOTS, ///< First timeslot for delayed RX operations.
 
-    RSCH_DLY_TS_NUM, ///< Number of delayed timeslots.
+    RSCH_DLY_TS_NUM = RSCH_DLY_RX + NRF_802154_DELAYED_TRX_RX_SLOTS, ///< Number of delayed timeslots.
 } rsch_dly_ts_id_t;
 
 /**
@@ -47,9 +47,13 @@
 #include <stdint.h>
 
 #include <nrf.h>
+#include "../nrf_802154_config.h"
 #include "../nrf_802154_debug.h"
+#include "../nrf_802154_stats.h"
 #include "platform/lp_timer/nrf_802154_lp_timer.h"
 
+#if !NRF_802154_TIMER_SCHED_HEAP_ENABLED
+
 #if defined(__ICCARM__)
 _Pragma("diag_suppress=Pe167")
 #endif
@@ -133,6 +137,74 @@ static inline bool is_timer_prior(const nrf_802154_timer_t * p_timer_1,
     return is_time_before(p_timer_1->t0 + p_timer_1->dt, p_timer_2->t0 + p_timer_2->dt);
 }
 
+/**
+ * @brief Check if @p p_timer has expired.
+ *
+ * A timer that expires within the granularity of the low power timer is considered expired, as it
+ * would be fired by the same compare event.
+ *
+ * @param[in]  p_timer  A pointer to the timer to check.
+ * @param[in]  now      Current time.
+ *
+ * @return  True if @p p_timer has expired, false otherwise.
+ */
+static inline bool is_timer_expired(const nrf_802154_timer_t * p_timer, uint32_t now)
+{
+    return is_time_before(p_timer->t0 + p_timer->dt, now + nrf_802154_lp_timer_granularity_get());
+}
+
+/**
+ * @brief Get the time at which the head timer is to be fired, taking slack of timers into account.
+ *
+ * The head timer is delayed within its slack window as long as it can be fired together with
+ * the following timers, but no timer is delayed beyond its own slack window.
+ *
+ * @param[in]  p_head  A pointer to the head timer.
+ *
+ * @return  Delta from @c t0 of @p p_head at which the head timer is to be fired.
+ */
+static uint32_t coalesced_dt_get(const volatile nrf_802154_timer_t * p_head)
+{
+    uint32_t t0     = p_head->t0;
+    uint32_t latest = t0 + p_head->dt + p_head->slack;
+
+    for (volatile nrf_802154_timer_t * p_cur = p_head->p_next;
+         (p_cur != NULL) && is_time_before(p_cur->t0 + p_cur->dt, latest);
+         p_cur = p_cur->p_next)
+    {
+        uint32_t cur_latest = p_cur->t0 + p_cur->dt + p_cur->slack;
+
+        if (is_time_before(cur_latest, latest))
+        {
+            latest = cur_latest;
+        }
+    }
+
+    return latest - t0;
+}
+
+/**
+ * @brief Check if @p p_timer is the head timer or expires within the slack window of the head timer.
+ *
+ * Adding such a timer may change the time at which the head timer is to be fired.
+ *
+ * @param[in]  p_timer  A pointer to the timer to check.
+ *
+ * @return  True if @p p_timer may change the firing time of the head timer, false otherwise.
+ */
+static bool is_in_head_window(const nrf_802154_timer_t * p_timer)
+{
+    volatile nrf_802154_timer_t * p_head = mp_head;
+
+    if (p_head == NULL)
+    {
+        return false;
+    }
+
+    return (p_head == p_timer) ||
+           is_time_before(p_timer->t0 + p_timer->dt, p_head->t0 + p_head->dt + p_head->slack);
+}
+
 /**
  * @brief Handle operation on timer with mutex protection.
  */
@@ -155,7 +227,7 @@ static inline void handle_timer(void)
             else
             {
                 uint32_t t0 = p_head->t0;
-                uint32_t dt = p_head->dt;
+                uint32_t dt = coalesced_dt_get(p_head);
 
                 // Set the timer only if current HEAD wasn't removed - otherwise t0 and dt might've been modified
                 // between reading t0 and dt and not be a valid combination.
@@ -333,7 +405,14 @@ uint32_t nrf_802154_timer_sched_remaining_time_get(const nrf_802154_timer_t * p_
     }
 }
 
-void nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up)
+bool nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up)
+{
+    return nrf_802154_timer_sched_add_with_slack(p_timer, round_up, 0);
+}
+
+bool nrf_802154_timer_sched_add_with_slack(nrf_802154_timer_t * p_timer,
+                                           bool                 round_up,
+                                           uint32_t             slack)
 {
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TSCH_ADD);
 
@@ -350,6 +429,8 @@ void nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up)
         handle_timer();
     }
 
+    p_timer->slack = slack;
+
     nrf_802154_timer_t ** pp_item;
     nrf_802154_timer_t  * p_next;
     uint8_t               queue_cntr;
@@ -401,12 +482,14 @@ void nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up)
         }
     }
 
-    if (mp_head == p_timer)
+    if (is_in_head_window(p_timer))
     {
         handle_timer();
     }
 
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TSCH_ADD);
+
+    return true;
 }
 
 void nrf_802154_timer_sched_remove(nrf_802154_timer_t * p_timer, bool * p_was_running)
@@ -449,9 +532,13 @@ void nrf_802154_lp_timer_fired(void)
 
     if (mutex_trylock(&m_fired_mutex))
     {
-        nrf_802154_timer_t * p_timer = (nrf_802154_timer_t *)mp_head;
+        nrf_802154_timer_t * p_timer      = (nrf_802154_timer_t *)mp_head;
+        uint32_t             timers_fired = 0;
+        bool                 expired      = (p_timer != NULL);
 
-        if (p_timer != NULL)
+        // The head timer triggered this event. Timers following it are fired in the same pass
+        // as long as they have expired, so that each of them does not need a separate interrupt.
+        while (expired)
         {
             nrf_802154_timer_callback_t callback  = p_timer->callback;
             void                      * p_context = p_timer->p_context;
@@ -463,9 +550,16 @@ void nrf_802154_lp_timer_fired(void)
             if (was_running && (callback != NULL))
             {
                 callback(p_context);
+                timers_fired++;
             }
+
+            p_timer = (nrf_802154_timer_t *)mp_head;
+            expired = (p_timer != NULL) &&
+                      is_timer_expired(p_timer, nrf_802154_lp_timer_time_get());
         }
 
+        nrf_802154_stats_timer_sched_fired_add(timers_fired);
+
         mutex_unlock(&m_fired_mutex);
     }
 
@@ -473,3 +567,5 @@ void nrf_802154_lp_timer_fired(void)
 
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TSCH_FIRED);
 }
+
+#endif // !NRF_802154_TIMER_SCHED_HEAP_ENABLED
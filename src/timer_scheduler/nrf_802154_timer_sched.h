@@ -45,6 +45,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -74,11 +76,16 @@ typedef struct nrf_802154_timer_s nrf_802154_timer_t;
  */
 struct nrf_802154_timer_s
 {
-    uint32_t                    t0;        ///< Base time of the timer, in microseconds.
-    uint32_t                    dt;        ///< Timer expiration delta from @p t0, in microseconds.
-    nrf_802154_timer_callback_t callback;  ///< Callback function called when timer expires.
-    void                      * p_context; ///< User-defined context passed to the callback function.
-    nrf_802154_timer_t        * p_next;    ///< Pointer to the next running timer.
+    uint32_t                    t0;                ///< Base time of the timer, in microseconds.
+    uint32_t                    dt;                ///< Timer expiration delta from @p t0, in microseconds.
+    uint32_t                    slack;             ///< Time by which the timer may expire later to be fired together with other timers, in microseconds. Set by the scheduler.
+    nrf_802154_timer_callback_t callback;          ///< Callback function called when timer expires.
+    void                      * p_context;         ///< User-defined context passed to the callback function.
+    nrf_802154_timer_t        * p_next;            ///< Pointer to the next running timer.
+#if NRF_802154_TIMER_SCHED_HEAP_ENABLED
+    uint32_t                    heap_idx;          ///< Position of the running timer in the scheduler heap ordered by expiration time.
+    uint32_t                    deadline_heap_idx; ///< Position of the running timer in the scheduler heap ordered by expiration time plus slack.
+#endif
 };
 
 /**
@@ -132,8 +139,11 @@ uint32_t nrf_802154_timer_sched_remaining_time_get(const nrf_802154_timer_t * p_
 /**
  * @brief Starts the given timer and adds it to the scheduler.
  *
- * @note Fields @c t0, @c dt, @c callback and @c p_context must be filled in @p p_timer before
- *       calling this function. The @c callback field cannot be NULL.
+ * @note Fields @c t0, @c dt, @c callback and @c p_context must be filled in @p p_timer
+ *       before calling this function. The @c callback field cannot be NULL.
+ *
+ * @note The timer is added without slack. Use @ref nrf_802154_timer_sched_add_with_slack to allow
+ *       the scheduler to delay the timer.
  *
  * @note Due to the timer granularity, the callback function cannot be called exactly
  *       at the specified time. Use @p round_up to specify if the given timer should expire before
@@ -143,8 +153,32 @@ uint32_t nrf_802154_timer_sched_remaining_time_get(const nrf_802154_timer_t * p_
  * @param[inout]  p_timer   Pointer to the timer to be started and added to the scheduler.
  * @param[in]     round_up  True if the timer is to expire after the specified time.
  *                          False if it is to expire before the specified time.
+ *
+ * @retval true   The timer has been added to the scheduler.
+ * @retval false  The timer could not be added, because @ref NRF_802154_TIMER_SCHED_HEAP_SIZE
+ *                timers are already running. The timer is not running in this case. Only the heap
+ *                backend can fail this way.
+ */
+bool nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up);
+
+/**
+ * @brief Starts the given timer with slack and adds it to the scheduler.
+ *
+ * A timer with non-zero @p slack may be fired up to @p slack microseconds after its expiration
+ * time. The scheduler uses this window to fire timers expiring close to each other in a single low
+ * power timer interrupt. Otherwise, this function works like @ref nrf_802154_timer_sched_add.
+ *
+ * @param[inout]  p_timer   Pointer to the timer to be started and added to the scheduler.
+ * @param[in]     round_up  True if the timer is to expire after the specified time.
+ *                          False if it is to expire before the specified time.
+ * @param[in]     slack     Time by which the timer may be fired later, in microseconds.
+ *
+ * @retval true   The timer has been added to the scheduler.
+ * @retval false  The timer could not be added. See @ref nrf_802154_timer_sched_add.
  */
-void nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up);
+bool nrf_802154_timer_sched_add_with_slack(nrf_802154_timer_t * p_timer,
+                                           bool                 round_up,
+                                           uint32_t             slack);
 
 /**
  * @brief Stops the given timer and removes it from the scheduler.
@@ -0,0 +1,574 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements timer scheduler for the nRF 802.15.4 driver using a binary heap.
+ *
+ *  Running timers are kept in two binary min-heaps. One is ordered by expiration time and gives
+ *  the order in which timers are fired. The other is ordered by expiration time plus slack, and its
+ *  root is the latest time at which the earliest timer can be fired. Adding and removing a timer
+ *  take logarithmic time. The heaps are modified with all interrupts disabled, including the RADIO
+ *  interrupt, so operations requested from different contexts are serialized instead of being
+ *  retried.
+ *
+ *  A single critical section performs at most one removal and one insertion in each heap, each
+ *  moving a timer through at most log2(@ref NRF_802154_TIMER_SCHED_HEAP_SIZE) levels, and one
+ *  update of the low power timer. Nothing in the critical section depends on the behavior of other
+ *  contexts or on the slack of the timers, so the time interrupts are disabled grows with the
+ *  logarithm of the heap size. Timer callbacks are called with interrupts enabled.
+ *
+ *  @note Timer scheduler shall not be used for adding/removing the same timer instance from two
+ *        contexts at the same time.
+ *
+ */
+
+#include "nrf_802154_timer_sched.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <nrf.h>
+#include "../nrf_802154_config.h"
+#include "../nrf_802154_debug.h"
+#include "../nrf_802154_stats.h"
+#include "platform/lp_timer/nrf_802154_lp_timer.h"
+
+#if NRF_802154_TIMER_SCHED_HEAP_ENABLED
+
+#if NRF_802154_DELAYED_TRX_ENABLED
+// Delayed timeslot timers of RSCH and receive timeout timers of delayed RX.
+#define DELAYED_TRX_TIMERS_NUM (NRF_802154_DELAYED_TRX_TX_SLOTS + \
+                                2 * NRF_802154_DELAYED_TRX_RX_SLOTS)
+#else
+#define DELAYED_TRX_TIMERS_NUM 0
+#endif
+
+#if NRF_802154_CSMA_CA_ENABLED
+#define CSMA_CA_TIMERS_NUM 1
+#else
+#define CSMA_CA_TIMERS_NUM 0
+#endif
+
+#if NRF_802154_ACK_TIMEOUT_ENABLED
+#define ACK_TIMEOUT_TIMERS_NUM 1
+#else
+#define ACK_TIMEOUT_TIMERS_NUM 0
+#endif
+
+#if NRF_802154_NOTIFY_RECEIVED_BATCH_ENABLED
+#define RX_BATCH_TIMERS_NUM 1
+#else
+#define RX_BATCH_TIMERS_NUM 0
+#endif
+
+/** Number of timers the driver itself can run at the same time. */
+#define DRIVER_TIMERS_NUM (DELAYED_TRX_TIMERS_NUM + CSMA_CA_TIMERS_NUM + ACK_TIMEOUT_TIMERS_NUM + \
+                           RX_BATCH_TIMERS_NUM)
+
+#if NRF_802154_TIMER_SCHED_HEAP_SIZE < DRIVER_TIMERS_NUM
+#error NRF_802154_TIMER_SCHED_HEAP_SIZE is smaller than the number of timers used by the driver
+#endif
+
+/// Orders in which the running timers are kept.
+typedef enum
+{
+    HEAP_ORDER_EXPIRATION, ///< Ordered by expiration time. Timers are fired in this order.
+    HEAP_ORDER_DEADLINE,   ///< Ordered by expiration time plus slack. The root limits the firing time.
+    HEAP_ORDERS_NUM,
+} heap_order_t;
+
+static nrf_802154_timer_t * m_heap[HEAP_ORDERS_NUM][NRF_802154_TIMER_SCHED_HEAP_SIZE]; ///< Running timers ordered as binary min-heaps.
+static uint32_t             m_heap_count;                                               ///< Number of running timers.
+
+/**
+ * @brief Enter critical section of the timer scheduler.
+ *
+ * @return Value of PRIMASK to be passed to @ref critical_section_exit.
+ */
+static inline uint32_t critical_section_enter(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    return primask;
+}
+
+/**
+ * @brief Exit critical section of the timer scheduler.
+ *
+ * @param[in]  primask  Value of PRIMASK returned by @ref critical_section_enter.
+ */
+static inline void critical_section_exit(uint32_t primask)
+{
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Check if @p time_1 is before @p time_2.
+ *
+ * @param[in]  time_1  First time to compare.
+ * @param[in]  time_2  Second time to compare.
+ *
+ * @return  True if @p time_1 is before @p time_2, false otherwise.
+ */
+static inline bool is_time_before(uint32_t time_1, uint32_t time_2)
+{
+    int32_t diff = time_1 - time_2;
+
+    return diff < 0;
+}
+
+/**
+ * @brief Get the time by which a timer is ordered in the given heap.
+ *
+ * @param[in]  order    Order of the heap.
+ * @param[in]  p_timer  A pointer to the timer.
+ *
+ * @return  Expiration time of the timer, extended by its slack in the heap ordered by deadlines.
+ */
+static inline uint32_t heap_key_get(heap_order_t order, const nrf_802154_timer_t * p_timer)
+{
+    uint32_t key = p_timer->t0 + p_timer->dt;
+
+    if (order == HEAP_ORDER_DEADLINE)
+    {
+        key += p_timer->slack;
+    }
+
+    return key;
+}
+
+/**
+ * @brief Check if @p p_timer_1 shall be placed before @p p_timer_2 in the given heap.
+ *
+ * @param[in]  order      Order of the heap.
+ * @param[in]  p_timer_1  A pointer to first timer to compare.
+ * @param[in]  p_timer_2  A pointer to second timer to compare.
+ *
+ * @return  True if @p p_timer_1 shall be placed before @p p_timer_2, false otherwise.
+ */
+static inline bool is_timer_prior(heap_order_t               order,
+                                  const nrf_802154_timer_t * p_timer_1,
+                                  const nrf_802154_timer_t * p_timer_2)
+{
+    return is_time_before(heap_key_get(order, p_timer_1), heap_key_get(order, p_timer_2));
+}
+
+/**
+ * @brief Check if @p p_timer has expired.
+ *
+ * A timer that expires within the granularity of the low power timer is considered expired, as it
+ * would be fired by the same compare event.
+ *
+ * @param[in]  p_timer  A pointer to the timer to check.
+ * @param[in]  now      Current time.
+ *
+ * @return  True if @p p_timer has expired, false otherwise.
+ */
+static inline bool is_timer_expired(const nrf_802154_timer_t * p_timer, uint32_t now)
+{
+    return is_time_before(p_timer->t0 + p_timer->dt, now + nrf_802154_lp_timer_granularity_get());
+}
+
+/**
+ * @brief Get the position of a timer in the given heap.
+ *
+ * @param[in]  order    Order of the heap.
+ * @param[in]  p_timer  Pointer to the timer.
+ *
+ * @return  Pointer to the position stored in the timer.
+ */
+static inline uint32_t * heap_idx_get(heap_order_t order, nrf_802154_timer_t * p_timer)
+{
+    return (order == HEAP_ORDER_EXPIRATION) ? &p_timer->heap_idx : &p_timer->deadline_heap_idx;
+}
+
+/**
+ * @brief Put a timer at the given position of the heap.
+ *
+ * @param[in]  order    Order of the heap.
+ * @param[in]  p_timer  Pointer to the timer.
+ * @param[in]  idx      Position in the heap.
+ */
+static inline void heap_put(heap_order_t order, nrf_802154_timer_t * p_timer, uint32_t idx)
+{
+    m_heap[order][idx]            = p_timer;
+    *heap_idx_get(order, p_timer) = idx;
+}
+
+/**
+ * @brief Check if a timer is in the heap.
+ *
+ * @param[in]  p_timer  Pointer to the timer.
+ *
+ * @retval true   The timer is running.
+ * @retval false  The timer is not running.
+ */
+static inline bool heap_contains(const nrf_802154_timer_t * p_timer)
+{
+    uint32_t idx = p_timer->heap_idx;
+
+    return (idx < m_heap_count) && (m_heap[HEAP_ORDER_EXPIRATION][idx] == p_timer);
+}
+
+/**
+ * @brief Move the timer at the given position towards the root until the heap order is restored.
+ *
+ * @param[in]  order  Order of the heap.
+ * @param[in]  idx    Position of the timer in the heap.
+ */
+static void heap_sift_up(heap_order_t order, uint32_t idx)
+{
+    nrf_802154_timer_t * p_timer = m_heap[order][idx];
+
+    while (idx > 0)
+    {
+        uint32_t parent = (idx - 1) / 2;
+
+        if (!is_timer_prior(order, p_timer, m_heap[order][parent]))
+        {
+            break;
+        }
+
+        heap_put(order, m_heap[order][parent], idx);
+        idx = parent;
+    }
+
+    heap_put(order, p_timer, idx);
+}
+
+/**
+ * @brief Move the timer at the given position towards the leaves until the heap order is restored.
+ *
+ * @param[in]  order  Order of the heap.
+ * @param[in]  idx    Position of the timer in the heap.
+ * @param[in]  count  Number of timers in the heap.
+ */
+static void heap_sift_down(heap_order_t order, uint32_t idx, uint32_t count)
+{
+    nrf_802154_timer_t * p_timer = m_heap[order][idx];
+
+    while (true)
+    {
+        uint32_t child = 2 * idx + 1;
+
+        if (child >= count)
+        {
+            break;
+        }
+
+        if ((child + 1 < count) &&
+            is_timer_prior(order, m_heap[order][child + 1], m_heap[order][child]))
+        {
+            child++;
+        }
+
+        if (!is_timer_prior(order, m_heap[order][child], p_timer))
+        {
+            break;
+        }
+
+        heap_put(order, m_heap[order][child], idx);
+        idx = child;
+    }
+
+    heap_put(order, p_timer, idx);
+}
+
+/**
+ * @brief Insert a timer into the heaps.
+ *
+ * @param[in]  p_timer  Pointer to the timer to insert.
+ *
+ * @retval true   The timer has been inserted.
+ * @retval false  The heaps are full. The heaps are left unchanged.
+ */
+static bool heap_insert(nrf_802154_timer_t * p_timer)
+{
+    if (m_heap_count >= NRF_802154_TIMER_SCHED_HEAP_SIZE)
+    {
+        return false;
+    }
+
+    for (heap_order_t order = 0; order < HEAP_ORDERS_NUM; order++)
+    {
+        heap_put(order, p_timer, m_heap_count);
+        heap_sift_up(order, m_heap_count);
+    }
+
+    m_heap_count++;
+
+    return true;
+}
+
+/**
+ * @brief Remove a running timer from the heaps.
+ *
+ * @param[in]  p_timer  Pointer to the timer to remove.
+ */
+static void heap_remove(nrf_802154_timer_t * p_timer)
+{
+    uint32_t last = --m_heap_count;
+
+    for (heap_order_t order = 0; order < HEAP_ORDERS_NUM; order++)
+    {
+        uint32_t             idx    = *heap_idx_get(order, p_timer);
+        nrf_802154_timer_t * p_last = m_heap[order][last];
+
+        if (idx == last)
+        {
+            continue;
+        }
+
+        heap_put(order, p_last, idx);
+
+        if ((idx > 0) && is_timer_prior(order, p_last, m_heap[order][(idx - 1) / 2]))
+        {
+            heap_sift_up(order, idx);
+        }
+        else
+        {
+            heap_sift_down(order, idx, last);
+        }
+    }
+}
+
+/**
+ * @brief Program the low power timer to expire with the earliest running timer.
+ *
+ * The earliest timer is delayed within its slack window as long as it can be fired together with
+ * the following timers. The firing time is the earliest end of a slack window among all running
+ * timers, which is the root of the heap ordered by deadlines, so no timer is delayed beyond its
+ * own slack window.
+ *
+ * Shall be called inside the critical section of the timer scheduler.
+ */
+static void handle_timer(void)
+{
+    if (m_heap_count == 0)
+    {
+        nrf_802154_lp_timer_stop();
+    }
+    else
+    {
+        nrf_802154_timer_t * p_head   = m_heap[HEAP_ORDER_EXPIRATION][0];
+        uint32_t             deadline = heap_key_get(HEAP_ORDER_DEADLINE,
+                                                     m_heap[HEAP_ORDER_DEADLINE][0]);
+
+        nrf_802154_lp_timer_start(p_head->t0, deadline - p_head->t0);
+    }
+}
+
+void nrf_802154_timer_sched_init(void)
+{
+    m_heap_count = 0;
+}
+
+void nrf_802154_timer_sched_deinit(void)
+{
+    nrf_802154_lp_timer_stop();
+
+    m_heap_count = 0;
+}
+
+uint32_t nrf_802154_timer_sched_time_get(void)
+{
+    return nrf_802154_lp_timer_time_get();
+}
+
+uint32_t nrf_802154_timer_sched_granularity_get(void)
+{
+    return nrf_802154_lp_timer_granularity_get();
+}
+
+bool nrf_802154_timer_sched_time_is_in_future(uint32_t now, uint32_t t0, uint32_t dt)
+{
+    uint32_t target_time = t0 + dt;
+    int32_t  difference  = target_time - now;
+
+    return difference > 0;
+}
+
+uint32_t nrf_802154_timer_sched_remaining_time_get(const nrf_802154_timer_t * p_timer)
+{
+    assert(p_timer != NULL);
+
+    uint32_t now        = nrf_802154_lp_timer_time_get();
+    uint32_t expiration = p_timer->t0 + p_timer->dt;
+    int32_t  remaining  = expiration - now;
+
+    if (remaining > 0)
+    {
+        return (uint32_t)remaining;
+    }
+    else
+    {
+        return 0ul;
+    }
+}
+
+bool nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up)
+{
+    return nrf_802154_timer_sched_add_with_slack(p_timer, round_up, 0);
+}
+
+bool nrf_802154_timer_sched_add_with_slack(nrf_802154_timer_t * p_timer,
+                                           bool                 round_up,
+                                           uint32_t             slack)
+{
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TSCH_ADD);
+
+    assert(p_timer != NULL);
+    assert(p_timer->callback != NULL);
+
+    nrf_802154_timer_t * p_head;
+    nrf_802154_timer_t * p_deadline_head;
+    uint32_t             primask;
+    bool                 result;
+
+    if (round_up)
+    {
+        p_timer->dt += nrf_802154_lp_timer_granularity_get() - 1;
+    }
+
+    primask = critical_section_enter();
+
+    p_head          = (m_heap_count == 0) ? NULL : m_heap[HEAP_ORDER_EXPIRATION][0];
+    p_deadline_head = (m_heap_count == 0) ? NULL : m_heap[HEAP_ORDER_DEADLINE][0];
+
+    if (heap_contains(p_timer))
+    {
+        heap_remove(p_timer);
+    }
+
+    p_timer->slack = slack;
+
+    result = heap_insert(p_timer);
+
+    // The firing time changes only with the earliest timer or the earliest deadline.
+    if ((m_heap[HEAP_ORDER_EXPIRATION][0] != p_head) ||
+        (m_heap[HEAP_ORDER_DEADLINE][0] != p_deadline_head) ||
+        (p_head == p_timer) ||
+        (p_deadline_head == p_timer))
+    {
+        handle_timer();
+    }
+
+    critical_section_exit(primask);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TSCH_ADD);
+
+    return result;
+}
+
+void nrf_802154_timer_sched_remove(nrf_802154_timer_t * p_timer, bool * p_was_running)
+{
+    assert(p_timer != NULL);
+
+    bool     was_running;
+    uint32_t primask = critical_section_enter();
+
+    was_running = heap_contains(p_timer);
+
+    if (was_running)
+    {
+        bool head = (p_timer->heap_idx == 0) || (p_timer->deadline_heap_idx == 0);
+
+        heap_remove(p_timer);
+
+        if (head)
+        {
+            handle_timer();
+        }
+    }
+
+    critical_section_exit(primask);
+
+    if (p_was_running != NULL)
+    {
+        *p_was_running = was_running;
+    }
+}
+
+bool nrf_802154_timer_sched_is_running(nrf_802154_timer_t * p_timer)
+{
+    bool     result;
+    uint32_t primask = critical_section_enter();
+
+    result = heap_contains(p_timer);
+
+    critical_section_exit(primask);
+
+    return result;
+}
+
+void nrf_802154_lp_timer_fired(void)
+{
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TSCH_FIRED);
+
+    uint32_t timers_fired = 0;
+    uint32_t primask      = critical_section_enter();
+    bool     expired      = (m_heap_count != 0);
+
+    // The earliest timer triggered this event. Timers following it are fired in the same pass
+    // as long as they have expired, so that each of them does not need a separate interrupt.
+    while (expired)
+    {
+        nrf_802154_timer_t        * p_timer   = m_heap[HEAP_ORDER_EXPIRATION][0];
+        nrf_802154_timer_callback_t callback  = p_timer->callback;
+        void                      * p_context = p_timer->p_context;
+
+        heap_remove(p_timer);
+
+        critical_section_exit(primask);
+
+        callback(p_context);
+        timers_fired++;
+
+        primask = critical_section_enter();
+        expired = (m_heap_count != 0) &&
+                  is_timer_expired(m_heap[HEAP_ORDER_EXPIRATION][0],
+                                   nrf_802154_lp_timer_time_get());
+    }
+
+    handle_timer();
+
+    critical_section_exit(primask);
+
+    nrf_802154_stats_timer_sched_fired_add(timers_fired);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TSCH_FIRED);
+}
+
+#endif // NRF_802154_TIMER_SCHED_HEAP_ENABLED
@@ -0,0 +1,197 @@
+/* Copyright (c) 2017 - 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include "nrf_802154_const.h"
+#include "mock_nrf_802154.h"
+#include "mock_nrf_802154_frame_parser.h"
+
+#ifdef NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+    #undef NRF_802154_ACK_DATA_HASH_TABLE_ENABLED
+#endif
+#define NRF_802154_ACK_DATA_HASH_TABLE_ENABLED 1
+
+#ifdef NRF_802154_PENDING_SHORT_ADDRESSES
+    #undef NRF_802154_PENDING_SHORT_ADDRESSES
+#endif
+#define NRF_802154_PENDING_SHORT_ADDRESSES     16
+
+#ifdef NRF_802154_PENDING_EXTENDED_ADDRESSES
+    #undef NRF_802154_PENDING_EXTENDED_ADDRESSES
+#endif
+#define NRF_802154_PENDING_EXTENDED_ADDRESSES  16
+
+#include "mac_features/ack_generator/nrf_802154_ack_data.c"
+
+#define TEST_NUM_ADDRESSES 16
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+static uint8_t m_test_addr_short[TEST_NUM_ADDRESSES][SHORT_ADDRESS_SIZE];
+static uint8_t m_test_addr_extended[TEST_NUM_ADDRESSES][EXTENDED_ADDRESS_SIZE];
+
+void setUp(void)
+{
+    nrf_802154_ack_data_init();
+
+    for (uint32_t i = 0; i < TEST_NUM_ADDRESSES; i++)
+    {
+        // Addresses differ in one byte only to produce hash collisions.
+        m_test_addr_short[i][0] = 0x10;
+        m_test_addr_short[i][1] = (uint8_t)(i * 3);
+
+        memset(m_test_addr_extended[i], 0x5a, EXTENDED_ADDRESS_SIZE);
+        m_test_addr_extended[i][7] = (uint8_t)i;
+    }
+}
+
+void tearDown(void)
+{
+
+}
+
+static bool is_found(const uint8_t * p_addr, bool extended)
+{
+    uint32_t location;
+
+    return addr_index_find(p_addr, &location, extended);
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void test_ShouldFindAllAddedAddresses(void)
+{
+    for (uint32_t i = 0; i < TEST_NUM_ADDRESSES; i++)
+    {
+        TEST_ASSERT_TRUE(nrf_802154_ack_data_for_addr_set(m_test_addr_short[i], false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0));
+        TEST_ASSERT_TRUE(nrf_802154_ack_data_for_addr_set(m_test_addr_extended[i], true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0));
+    }
+
+    for (uint32_t i = 0; i < TEST_NUM_ADDRESSES; i++)
+    {
+        TEST_ASSERT_TRUE(is_found(m_test_addr_short[i], false));
+        TEST_ASSERT_TRUE(is_found(m_test_addr_extended[i], true));
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_NUM_ADDRESSES, m_neighbors.num_of_short_addr);
+    TEST_ASSERT_EQUAL_UINT32(TEST_NUM_ADDRESSES, m_neighbors.num_of_ext_addr);
+}
+
+void test_ShouldFailToAddAddressWhenListIsFull(void)
+{
+    uint8_t addr[SHORT_ADDRESS_SIZE] = { 0xab, 0xcd };
+
+    for (uint32_t i = 0; i < TEST_NUM_ADDRESSES; i++)
+    {
+        nrf_802154_ack_data_for_addr_set(m_test_addr_short[i], false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    }
+
+    TEST_ASSERT_FALSE(nrf_802154_ack_data_for_addr_set(addr, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0));
+    TEST_ASSERT_FALSE(is_found(addr, false));
+}
+
+void test_ShouldKeepOtherAddressesReachableAfterRemoval(void)
+{
+    for (uint32_t i = 0; i < TEST_NUM_ADDRESSES; i++)
+    {
+        nrf_802154_ack_data_for_addr_set(m_test_addr_extended[i], true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    }
+
+    // Remove every other address to break probe sequences in many places.
+    for (uint32_t i = 0; i < TEST_NUM_ADDRESSES; i += 2)
+    {
+        TEST_ASSERT_TRUE(nrf_802154_ack_data_for_addr_clear(m_test_addr_extended[i], true, NRF_802154_ACK_DATA_PENDING_BIT));
+    }
+
+    for (uint32_t i = 0; i < TEST_NUM_ADDRESSES; i++)
+    {
+        TEST_ASSERT_EQUAL((i % 2) != 0, is_found(m_test_addr_extended[i], true));
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_NUM_ADDRESSES / 2, m_neighbors.num_of_ext_addr);
+}
+
+void test_ShouldKeepIeDataAfterPendingBitReset(void)
+{
+    uint8_t         ie_data[] = { 0x01, 0x02 };
+    const uint8_t * p_ie;
+    uint8_t         ie_len;
+
+    for (uint32_t i = 0; i < TEST_NUM_ADDRESSES; i++)
+    {
+        nrf_802154_ack_data_for_addr_set(m_test_addr_short[i], false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    }
+
+    nrf_802154_ack_data_for_addr_set(m_test_addr_short[5], false, NRF_802154_ACK_DATA_IE, ie_data, sizeof(ie_data));
+
+    nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
+
+    TEST_ASSERT_EQUAL_UINT32(1, m_neighbors.num_of_short_addr);
+    TEST_ASSERT_EQUAL_UINT32(0, m_neighbors.num_of_short_data[NRF_802154_ACK_DATA_PENDING_BIT]);
+
+    p_ie = nrf_802154_ack_data_ie_get(m_test_addr_short[5], false, &ie_len);
+    TEST_ASSERT_EQUAL_UINT8(sizeof(ie_data), ie_len);
+    TEST_ASSERT_EQUAL_MEMORY(ie_data, p_ie, sizeof(ie_data));
+
+    for (uint32_t i = 0; i < TEST_NUM_ADDRESSES; i++)
+    {
+        TEST_ASSERT_EQUAL(i == 5, is_found(m_test_addr_short[i], false));
+    }
+}
+
+void test_ShouldAddAndClearBatchOfAddresses(void)
+{
+    uint8_t addrs[TEST_NUM_ADDRESSES][EXTENDED_ADDRESS_SIZE];
+
+    memcpy(addrs, m_test_addr_extended, sizeof(addrs));
+
+    TEST_ASSERT_TRUE(nrf_802154_ack_data_for_addr_set_batch(&addrs[0][0], TEST_NUM_ADDRESSES, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0));
+    TEST_ASSERT_EQUAL_UINT32(TEST_NUM_ADDRESSES, m_neighbors.num_of_ext_addr);
+
+    for (uint32_t i = 0; i < TEST_NUM_ADDRESSES; i++)
+    {
+        TEST_ASSERT_TRUE(is_found(m_test_addr_extended[i], true));
+    }
+
+    memcpy(addrs, m_test_addr_extended, sizeof(addrs));
+
+    TEST_ASSERT_TRUE(nrf_802154_ack_data_for_addr_clear_batch(&addrs[0][0], TEST_NUM_ADDRESSES / 2, true, NRF_802154_ACK_DATA_PENDING_BIT));
+    TEST_ASSERT_EQUAL_UINT32(TEST_NUM_ADDRESSES / 2, m_neighbors.num_of_ext_addr);
+
+    for (uint32_t i = 0; i < TEST_NUM_ADDRESSES; i++)
+    {
+        TEST_ASSERT_EQUAL(i >= TEST_NUM_ADDRESSES / 2, is_found(m_test_addr_extended[i], true));
+    }
+}
@@ -73,8 +73,8 @@ void setUp(void)
 
 void tearDown(void)
 {
-    memset(m_pending_bit.extended_addr, 0, sizeof(m_pending_bit.extended_addr));
-    memset(m_pending_bit.short_addr, 0xff, sizeof(m_pending_bit.short_addr));
+    memset(m_neighbors.extended_addr, 0, sizeof(m_neighbors.extended_addr));
+    memset(m_neighbors.short_addr, 0xff, sizeof(m_neighbors.short_addr));
 }
 
 /***********************************************************************************/
@@ -169,10 +169,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_3, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_4, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -183,10 +183,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_4, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_3, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -197,10 +197,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_2, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_4, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -211,10 +211,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_4, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_2, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -225,10 +225,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_2, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_3, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -239,10 +239,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_3, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_2, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -253,10 +253,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_3, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_4, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -267,10 +267,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_4, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_3, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -281,10 +281,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_4, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -295,10 +295,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_4, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -309,10 +309,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_3, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -323,10 +323,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_3, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -337,10 +337,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_2, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_4, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -351,10 +351,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_4, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_2, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -365,10 +365,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_4, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -379,10 +379,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_4, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -393,10 +393,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_2, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -407,10 +407,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_2, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -421,10 +421,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_2, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_3, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -435,10 +435,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_3, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_2, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -449,10 +449,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_3, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -463,10 +463,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_3, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -477,10 +477,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_2, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -491,10 +491,10 @@ void test_ShouldKeepAscendingOrderAfterAddingExtendedAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_extended_2, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[3], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[3].addr, sizeof(test_addr_extended_4));
 
     nrf_802154_ack_data_reset(true, NRF_802154_ACK_DATA_PENDING_BIT);
 }
@@ -510,10 +510,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_4, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -524,10 +524,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_4, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -538,10 +538,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_4, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -552,10 +552,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_4, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -566,10 +566,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -580,10 +580,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -594,10 +594,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_4, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -608,10 +608,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_4, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -622,10 +622,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_4, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -636,10 +636,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_4, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -650,10 +650,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -664,10 +664,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -678,10 +678,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_4, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -692,10 +692,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_4, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -706,10 +706,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_4, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -720,10 +720,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_4, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -734,10 +734,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -748,10 +748,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -762,10 +762,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -776,10 +776,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -790,10 +790,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -804,10 +804,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -818,10 +818,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 
@@ -832,10 +832,10 @@ void test_ShouldKeepAscendingOrderAfterAddingShortAddressToTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_pending_bit.short_addr[2], sizeof(test_addr_short_3));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[3], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_3, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_3));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[3].addr, sizeof(test_addr_short_4));
 
     nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
 }
@@ -850,13 +850,13 @@ void test_ShouldNotAddAddressWhenAddressAlreadyOnTheList(void)
     TEST_ASSERT_TRUE(result);
     result = nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     TEST_ASSERT_TRUE(result);
-    TEST_ASSERT_EQUAL_UINT8(1, m_pending_bit.num_of_ext_addr);
+    TEST_ASSERT_EQUAL_UINT8(1, m_neighbors.num_of_ext_data[NRF_802154_ACK_DATA_PENDING_BIT]);
 
     result = nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     TEST_ASSERT_TRUE(result);
     result = nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     TEST_ASSERT_TRUE(result);
-    TEST_ASSERT_EQUAL_UINT8(1, m_pending_bit.num_of_short_addr);
+    TEST_ASSERT_EQUAL_UINT8(1, m_neighbors.num_of_short_data[NRF_802154_ACK_DATA_PENDING_BIT]);
 }
 
 void test_ShouldRemoveAddressFromTheList(void)
@@ -909,13 +909,13 @@ void test_ShouldKeepAscendingOrderAfterRemovingAddressFromTheList(void)
     nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
     nrf_802154_ack_data_for_addr_clear(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT);
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_pending_bit.extended_addr[0], sizeof(test_addr_extended_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_pending_bit.extended_addr[1], sizeof(test_addr_extended_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_pending_bit.extended_addr[2], sizeof(test_addr_extended_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, sizeof(test_addr_extended_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_2, m_neighbors.extended_addr[1].addr, sizeof(test_addr_extended_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[2].addr, sizeof(test_addr_extended_4));
 
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_pending_bit.short_addr[0], sizeof(test_addr_short_1));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_pending_bit.short_addr[1], sizeof(test_addr_short_2));
-    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_pending_bit.short_addr[2], sizeof(test_addr_short_4));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_2));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[2].addr, sizeof(test_addr_short_4));
 }
 
 void test_ShouldNotRemoveAddressWhenAddressNotOnTheList(void)
@@ -990,3 +990,200 @@ void test_ShouldSetAckPendingBit(void)
     result = nrf_802154_ack_data_pending_bit_should_be_set(test_psdu_short);
     TEST_ASSERT_TRUE(result);
 }
+
+void test_ShouldStorePendingBitAndIeInSingleEntry(void)
+{
+    nrf_802154_ack_data_init();
+
+    uint8_t ie_data[] = { 0x01, 0x02, 0x03 };
+    bool    result;
+
+    result = nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    TEST_ASSERT_TRUE(result);
+    result = nrf_802154_ack_data_for_addr_set(test_addr_extended_1, true, NRF_802154_ACK_DATA_IE, ie_data, sizeof(ie_data));
+    TEST_ASSERT_TRUE(result);
+
+    TEST_ASSERT_EQUAL_UINT32(1, m_neighbors.num_of_ext_addr);
+    TEST_ASSERT_EQUAL_UINT32(1, m_neighbors.num_of_ext_data[NRF_802154_ACK_DATA_PENDING_BIT]);
+    TEST_ASSERT_EQUAL_UINT32(1, m_neighbors.num_of_ext_data[NRF_802154_ACK_DATA_IE]);
+
+    // Clearing one type of data keeps the other one.
+    result = nrf_802154_ack_data_for_addr_clear(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT);
+    TEST_ASSERT_TRUE(result);
+    TEST_ASSERT_EQUAL_UINT32(1, m_neighbors.num_of_ext_addr);
+
+    result = nrf_802154_ack_data_for_addr_clear(test_addr_extended_1, true, NRF_802154_ACK_DATA_PENDING_BIT);
+    TEST_ASSERT_FALSE(result);
+
+    result = nrf_802154_ack_data_for_addr_clear(test_addr_extended_1, true, NRF_802154_ACK_DATA_IE);
+    TEST_ASSERT_TRUE(result);
+    TEST_ASSERT_EQUAL_UINT32(0, m_neighbors.num_of_ext_addr);
+}
+
+void test_ShouldLimitEachDataTypeSeparately(void)
+{
+    nrf_802154_ack_data_init();
+
+    uint8_t ie_data[] = { 0x01 };
+    bool    result;
+
+    nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    nrf_802154_ack_data_for_addr_set(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    nrf_802154_ack_data_for_addr_set(test_addr_short_4, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+
+    result = nrf_802154_ack_data_for_addr_set(test_addr_short_5, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    TEST_ASSERT_FALSE(result);
+
+    // IE data list is independent of the pending bit list.
+    result = nrf_802154_ack_data_for_addr_set(test_addr_short_5, false, NRF_802154_ACK_DATA_IE, ie_data, sizeof(ie_data));
+    TEST_ASSERT_TRUE(result);
+    result = nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_IE, ie_data, sizeof(ie_data));
+    TEST_ASSERT_TRUE(result);
+
+    TEST_ASSERT_EQUAL_UINT32(5, m_neighbors.num_of_short_addr);
+
+    // Reset of pending bits keeps the IE data.
+    nrf_802154_ack_data_reset(false, NRF_802154_ACK_DATA_PENDING_BIT);
+
+    TEST_ASSERT_EQUAL_UINT32(2, m_neighbors.num_of_short_addr);
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, sizeof(test_addr_short_1));
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_5, m_neighbors.short_addr[1].addr, sizeof(test_addr_short_5));
+}
+
+void test_ShouldGetPendingBitAndIeInSingleCall(void)
+{
+    nrf_802154_ack_data_init();
+
+    uint8_t                            ie_data[]  = { 0x01, 0x02, 0x03 };
+    nrf_802154_frame_parser_mhr_data_t mhr_fields =
+    {
+        .p_src_addr    = test_addr_short_1,
+        .src_addr_size = SHORT_ADDRESS_SIZE,
+    };
+    const uint8_t * p_ie;
+    uint8_t         ie_len;
+    bool            pending_bit;
+
+    p_ie = nrf_802154_ack_data_get(test_psdu_short, &mhr_fields, &pending_bit, &ie_len);
+    TEST_ASSERT_NULL(p_ie);
+    TEST_ASSERT_EQUAL_UINT8(0, ie_len);
+    TEST_ASSERT_FALSE(pending_bit);
+
+    nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_IE, ie_data, sizeof(ie_data));
+
+    p_ie = nrf_802154_ack_data_get(test_psdu_short, &mhr_fields, &pending_bit, &ie_len);
+    TEST_ASSERT_EQUAL_UINT8(sizeof(ie_data), ie_len);
+    TEST_ASSERT_EQUAL_MEMORY(ie_data, p_ie, sizeof(ie_data));
+    TEST_ASSERT_TRUE(pending_bit);
+}
+
+void test_ShouldAddBatchOfAddressesInAscendingOrder(void)
+{
+    nrf_802154_ack_data_init();
+
+    uint8_t addrs[4][EXTENDED_ADDRESS_SIZE];
+    bool    result;
+
+    result = nrf_802154_ack_data_for_addr_set(test_addr_extended_3, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    TEST_ASSERT_TRUE(result);
+
+    // Unsorted batch with a duplicate and an address that is already on the list.
+    memcpy(addrs[0], test_addr_extended_4, EXTENDED_ADDRESS_SIZE);
+    memcpy(addrs[1], test_addr_extended_1, EXTENDED_ADDRESS_SIZE);
+    memcpy(addrs[2], test_addr_extended_3, EXTENDED_ADDRESS_SIZE);
+    memcpy(addrs[3], test_addr_extended_1, EXTENDED_ADDRESS_SIZE);
+
+    result = nrf_802154_ack_data_for_addr_set_batch(&addrs[0][0], 4, true, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    TEST_ASSERT_TRUE(result);
+
+    TEST_ASSERT_EQUAL_UINT32(3, m_neighbors.num_of_ext_addr);
+    TEST_ASSERT_EQUAL_UINT32(3, m_neighbors.num_of_ext_data[NRF_802154_ACK_DATA_PENDING_BIT]);
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_1, m_neighbors.extended_addr[0].addr, EXTENDED_ADDRESS_SIZE);
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_3, m_neighbors.extended_addr[1].addr, EXTENDED_ADDRESS_SIZE);
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_extended_4, m_neighbors.extended_addr[2].addr, EXTENDED_ADDRESS_SIZE);
+}
+
+void test_ShouldNotAddBatchOfAddressesWhenListWouldOverflow(void)
+{
+    nrf_802154_ack_data_init();
+
+    uint8_t addrs[3][SHORT_ADDRESS_SIZE];
+    bool    result;
+
+    nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+
+    memcpy(addrs[0], test_addr_short_5, SHORT_ADDRESS_SIZE);
+    memcpy(addrs[1], test_addr_short_3, SHORT_ADDRESS_SIZE);
+    memcpy(addrs[2], test_addr_short_4, SHORT_ADDRESS_SIZE);
+
+    result = nrf_802154_ack_data_for_addr_set_batch(&addrs[0][0], 3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    TEST_ASSERT_FALSE(result);
+
+    TEST_ASSERT_EQUAL_UINT32(2, m_neighbors.num_of_short_addr);
+    TEST_ASSERT_EQUAL_UINT32(2, m_neighbors.num_of_short_data[NRF_802154_ACK_DATA_PENDING_BIT]);
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_1, m_neighbors.short_addr[0].addr, SHORT_ADDRESS_SIZE);
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[1].addr, SHORT_ADDRESS_SIZE);
+}
+
+void test_ShouldSetIeDataForBatchOfAddresses(void)
+{
+    nrf_802154_ack_data_init();
+
+    uint8_t ie_data[] = { 0x01, 0x02 };
+    uint8_t addrs[2][SHORT_ADDRESS_SIZE];
+    bool    result;
+
+    nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+
+    memcpy(addrs[0], test_addr_short_2, SHORT_ADDRESS_SIZE);
+    memcpy(addrs[1], test_addr_short_1, SHORT_ADDRESS_SIZE);
+
+    result = nrf_802154_ack_data_for_addr_set_batch(&addrs[0][0], 2, false, NRF_802154_ACK_DATA_IE, ie_data, sizeof(ie_data));
+    TEST_ASSERT_TRUE(result);
+
+    TEST_ASSERT_EQUAL_UINT32(2, m_neighbors.num_of_short_addr);
+    TEST_ASSERT_EQUAL_UINT32(2, m_neighbors.num_of_short_data[NRF_802154_ACK_DATA_IE]);
+    TEST_ASSERT_EQUAL_UINT8(data_flag_get(NRF_802154_ACK_DATA_IE), m_neighbors.short_addr[0].data.flags);
+    TEST_ASSERT_EQUAL_UINT8(data_flag_get(NRF_802154_ACK_DATA_PENDING_BIT) | data_flag_get(NRF_802154_ACK_DATA_IE),
+                            m_neighbors.short_addr[1].data.flags);
+    TEST_ASSERT_EQUAL_UINT8(sizeof(ie_data), m_neighbors.short_addr[0].data.ie_data.len);
+    TEST_ASSERT_EQUAL_MEMORY(ie_data, m_neighbors.short_addr[1].data.ie_data.p_data, sizeof(ie_data));
+}
+
+void test_ShouldClearBatchOfAddresses(void)
+{
+    nrf_802154_ack_data_init();
+
+    uint8_t addrs[3][SHORT_ADDRESS_SIZE];
+    bool    result;
+
+    nrf_802154_ack_data_for_addr_set(test_addr_short_1, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    nrf_802154_ack_data_for_addr_set(test_addr_short_2, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    nrf_802154_ack_data_for_addr_set(test_addr_short_3, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+    nrf_802154_ack_data_for_addr_set(test_addr_short_4, false, NRF_802154_ACK_DATA_PENDING_BIT, NULL, 0);
+
+    memcpy(addrs[0], test_addr_short_3, SHORT_ADDRESS_SIZE);
+    memcpy(addrs[1], test_addr_short_1, SHORT_ADDRESS_SIZE);
+    memcpy(addrs[2], test_addr_short_3, SHORT_ADDRESS_SIZE);
+
+    result = nrf_802154_ack_data_for_addr_clear_batch(&addrs[0][0], 3, false, NRF_802154_ACK_DATA_PENDING_BIT);
+    TEST_ASSERT_TRUE(result);
+
+    TEST_ASSERT_EQUAL_UINT32(2, m_neighbors.num_of_short_addr);
+    TEST_ASSERT_EQUAL_UINT32(2, m_neighbors.num_of_short_data[NRF_802154_ACK_DATA_PENDING_BIT]);
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[0].addr, SHORT_ADDRESS_SIZE);
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_4, m_neighbors.short_addr[1].addr, SHORT_ADDRESS_SIZE);
+
+    // Missing address is reported, but the remaining ones are removed.
+    memcpy(addrs[0], test_addr_short_5, SHORT_ADDRESS_SIZE);
+    memcpy(addrs[1], test_addr_short_4, SHORT_ADDRESS_SIZE);
+
+    result = nrf_802154_ack_data_for_addr_clear_batch(&addrs[0][0], 2, false, NRF_802154_ACK_DATA_PENDING_BIT);
+    TEST_ASSERT_FALSE(result);
+
+    TEST_ASSERT_EQUAL_UINT32(1, m_neighbors.num_of_short_addr);
+    TEST_ASSERT_EQUAL_MEMORY(test_addr_short_2, m_neighbors.short_addr[0].addr, SHORT_ADDRESS_SIZE);
+}
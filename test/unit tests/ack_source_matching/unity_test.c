@@ -86,8 +86,8 @@ void setUp(void)
 
 void tearDown(void)
 {
-    memset(m_pending_bit.extended_addr, 0, sizeof(m_pending_bit.extended_addr));
-    memset(m_pending_bit.short_addr, 0xff, sizeof(m_pending_bit.short_addr));
+    memset(m_neighbors.extended_addr, 0, sizeof(m_neighbors.extended_addr));
+    memset(m_neighbors.short_addr, 0xff, sizeof(m_neighbors.short_addr));
 
     test_psdu_extended[test_mhr_data_extended.addressing_end_offset] = MAC_CMD_DATA_REQ;
     test_psdu_short[test_mhr_data_short.addressing_end_offset]       = MAC_CMD_DATA_REQ;
@@ -0,0 +1,221 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+
+#ifdef NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+#undef NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED
+#endif
+#define NRF_802154_CSMA_CA_HW_BACKOFF_ENABLED 1
+
+#include "mock_nrf_802154_debug.h"
+#include "mock_nrf_802154_notification.h"
+#include "mock_nrf_802154_pib.h"
+#include "mock_nrf_802154_random.h"
+#include "mock_nrf_802154_request.h"
+#include "mock_nrf_802154_timer_sched.h"
+
+#include "nrf_802154_csma_ca.c"
+
+#define MIN_BE            3 ///< Minimum backoff exponent used by the tests.
+#define MAX_BE            4 ///< Maximum backoff exponent used by the tests.
+#define MAX_CSMA_BACKOFFS 4 ///< Maximum number of backoffs used by the tests.
+#define RANDOM_VALUE      5 ///< Random number drawn for every backoff.
+
+static uint8_t m_frame[]       = {5, 0x41, 0x98, 0x01, 0x00, 0x00};
+static uint8_t m_other_frame[] = {5, 0x41, 0x98, 0x02, 0x00, 0x00};
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+    m_is_running = false;
+    m_hw_backoff = false;
+}
+
+void tearDown(void)
+{
+
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+static void random_backoff_verify(void)
+{
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(0);
+    nrf_802154_random_get_ExpectAndReturn(RANDOM_VALUE);
+    nrf_802154_timer_sched_add_with_slack_ExpectAndReturn(&m_timer,
+                                                          false,
+                                                          NRF_802154_CSMA_CA_BACKOFF_SLACK,
+                                                          true);
+}
+
+static void procedure_with_backoffs_start(uint8_t max_csma_backoffs)
+{
+    nrf_802154_csma_ca_params_t params =
+    {
+        .min_be            = MIN_BE,
+        .max_be            = MAX_BE,
+        .max_csma_backoffs = max_csma_backoffs,
+    };
+
+    random_backoff_verify();
+
+    nrf_802154_csma_ca_start(m_frame, &params);
+}
+
+static void procedure_start(void)
+{
+    procedure_with_backoffs_start(MAX_CSMA_BACKOFFS);
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+// Every busy channel handled by the core is counted once, and the core stops backing off when
+// NB reaches macMaxCsmaBackoffs.
+void test_BusyChannelHookReachesBackoffLimit(void)
+{
+    uint32_t backoff;
+
+    procedure_start();
+
+    for (uint32_t i = 1; i < MAX_CSMA_BACKOFFS; i++)
+    {
+        uint8_t be = (MIN_BE + i < MAX_BE) ? (MIN_BE + i) : MAX_BE;
+
+        nrf_802154_random_get_ExpectAndReturn(RANDOM_VALUE);
+
+        TEST_ASSERT_TRUE(nrf_802154_csma_ca_tx_busy_channel_hook(m_frame, &backoff));
+        TEST_ASSERT_EQUAL_UINT32((RANDOM_VALUE % (1 << be)) * UNIT_BACKOFF_PERIOD, backoff);
+        TEST_ASSERT_EQUAL_UINT8(i, m_nb);
+        TEST_ASSERT_EQUAL_UINT8(be, m_be);
+        TEST_ASSERT_TRUE(m_hw_backoff);
+    }
+
+    TEST_ASSERT_FALSE(nrf_802154_csma_ca_tx_busy_channel_hook(m_frame, &backoff));
+    TEST_ASSERT_EQUAL_UINT8(MAX_CSMA_BACKOFFS, m_nb);
+    TEST_ASSERT_FALSE(procedure_is_running());
+    TEST_ASSERT_FALSE(m_hw_backoff);
+
+    // The core reports the failure to the higher layer.
+    TEST_ASSERT_TRUE(nrf_802154_csma_ca_tx_failed_hook(m_frame, NRF_802154_TX_ERROR_BUSY_CHANNEL));
+}
+
+// A frame that is not transmitted by the CSMA-CA procedure does not affect its counters.
+void test_BusyChannelHookIgnoresOtherFrames(void)
+{
+    uint32_t backoff;
+
+    procedure_start();
+
+    TEST_ASSERT_FALSE(nrf_802154_csma_ca_tx_busy_channel_hook(m_other_frame, &backoff));
+    TEST_ASSERT_EQUAL_UINT8(0, m_nb);
+    TEST_ASSERT_EQUAL_UINT8(MIN_BE, m_be);
+    TEST_ASSERT_FALSE(m_hw_backoff);
+}
+
+// If the core cannot time the backoff accepted by the hook, the backoff is timed by the timer
+// scheduler instead and it is not counted again.
+void test_FailedHardwareBackoffIsNotCountedTwice(void)
+{
+    uint32_t backoff;
+
+    procedure_start();
+
+    nrf_802154_random_get_ExpectAndReturn(RANDOM_VALUE);
+
+    TEST_ASSERT_TRUE(nrf_802154_csma_ca_tx_busy_channel_hook(m_frame, &backoff));
+    TEST_ASSERT_EQUAL_UINT8(1, m_nb);
+
+    random_backoff_verify();
+
+    TEST_ASSERT_FALSE(nrf_802154_csma_ca_tx_failed_hook(m_frame,
+                                                        NRF_802154_TX_ERROR_BUSY_CHANNEL));
+    TEST_ASSERT_EQUAL_UINT8(1, m_nb);
+    TEST_ASSERT_EQUAL_UINT8(MIN_BE + 1, m_be);
+    TEST_ASSERT_FALSE(m_hw_backoff);
+    TEST_ASSERT_TRUE(procedure_is_running());
+
+    // The next busy channel detected without the hook is counted as usual.
+    random_backoff_verify();
+
+    TEST_ASSERT_FALSE(nrf_802154_csma_ca_tx_failed_hook(m_frame,
+                                                        NRF_802154_TX_ERROR_BUSY_CHANNEL));
+    TEST_ASSERT_EQUAL_UINT8(2, m_nb);
+}
+
+// The backoff limit is reached in the same way when the hook succeeds only for some attempts.
+void test_FailedHardwareBackoffDoesNotExtendProcedure(void)
+{
+    uint32_t backoff;
+
+    procedure_start();
+
+    for (uint32_t i = 1; i < MAX_CSMA_BACKOFFS; i++)
+    {
+        nrf_802154_random_get_ExpectAndReturn(RANDOM_VALUE);
+
+        TEST_ASSERT_TRUE(nrf_802154_csma_ca_tx_busy_channel_hook(m_frame, &backoff));
+
+        random_backoff_verify();
+
+        TEST_ASSERT_FALSE(nrf_802154_csma_ca_tx_failed_hook(m_frame,
+                                                            NRF_802154_TX_ERROR_BUSY_CHANNEL));
+        TEST_ASSERT_EQUAL_UINT8(i, m_nb);
+    }
+
+    TEST_ASSERT_TRUE(nrf_802154_csma_ca_tx_failed_hook(m_frame, NRF_802154_TX_ERROR_BUSY_CHANNEL));
+    TEST_ASSERT_EQUAL_UINT8(MAX_CSMA_BACKOFFS, m_nb);
+    TEST_ASSERT_FALSE(procedure_is_running());
+}
+
+// With macMaxCsmaBackoffs of zero the channel access fails when the channel is found busy after
+// the first backoff, and a failed transmit request is reported as a busy channel.
+void test_ZeroMaxBackoffsFailsOnFirstBusyChannel(void)
+{
+    uint32_t backoff;
+
+    procedure_with_backoffs_start(0);
+
+    TEST_ASSERT_FALSE(nrf_802154_csma_ca_tx_busy_channel_hook(m_frame, &backoff));
+    TEST_ASSERT_FALSE(procedure_is_running());
+
+    nrf_802154_notify_transmit_failed_Expect(m_frame, NRF_802154_TX_ERROR_BUSY_CHANNEL);
+
+    notify_busy_channel(false);
+}
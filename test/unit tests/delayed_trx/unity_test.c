@@ -0,0 +1,377 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+
+#ifdef NRF_802154_DELAYED_TRX_TX_SLOTS
+#undef NRF_802154_DELAYED_TRX_TX_SLOTS
+#endif
+#define NRF_802154_DELAYED_TRX_TX_SLOTS 2
+
+#ifdef NRF_802154_DELAYED_TRX_RX_SLOTS
+#undef NRF_802154_DELAYED_TRX_RX_SLOTS
+#endif
+#define NRF_802154_DELAYED_TRX_RX_SLOTS 32
+
+#ifdef NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED
+#undef NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED
+#endif
+#define NRF_802154_DELAYED_TRX_SETUP_TIME_CALIBRATION_ENABLED 1
+
+#ifdef NRF_802154_DELAYED_TRX_SETUP_TIME_PERCENTILE
+#undef NRF_802154_DELAYED_TRX_SETUP_TIME_PERCENTILE
+#endif
+#define NRF_802154_DELAYED_TRX_SETUP_TIME_PERCENTILE 99
+
+#include "mock_nrf_802154_debug.h"
+#include "mock_nrf_802154_frame_parser.h"
+#include "mock_nrf_802154_notification.h"
+#include "mock_nrf_802154_pib.h"
+#include "mock_nrf_802154_request.h"
+#include "mock_nrf_802154_rsch.h"
+#include "mock_nrf_802154_timer_coord.h"
+#include "mock_nrf_802154_timer_sched.h"
+
+#define __LDREXB(ptr)           (*(ptr))
+#define __STREXB(value, ptr)    (*(ptr) = (value), 0)
+#define __CLREX()
+#define __DMB()
+
+#include "nrf_802154_delayed_trx.c"
+
+#define WINDOW_T0      1000000UL ///< Base time of the queued receive windows [us].
+#define WINDOW_PERIOD  10000UL   ///< Distance between consecutive receive windows [us].
+#define WINDOW_TIMEOUT 2000UL    ///< Length of each receive window [us].
+#define WINDOW_LATENCY 7UL       ///< Delay added to the start of each following window [us].
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+    for (uint32_t i = 0; i < RSCH_DLY_TS_NUM; i++)
+    {
+        m_dly_op_state[i] = DELAYED_TRX_OP_STATE_STOPPED;
+    }
+
+    memset(&m_tx_setup_time, 0, sizeof(m_tx_setup_time));
+    memset(&m_rx_setup_time, 0, sizeof(m_rx_setup_time));
+}
+
+void tearDown(void)
+{
+
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+static uint32_t window_dt_get(uint32_t window)
+{
+    return (window + 1) * WINDOW_PERIOD;
+}
+
+static uint8_t window_channel_get(uint32_t window)
+{
+    return 11 + (window % 16);
+}
+
+static void window_request_verify(uint32_t window)
+{
+    uint16_t timeslot_length = WINDOW_TIMEOUT + nrf_802154_rx_duration_get(MAX_PACKET_SIZE, true);
+
+    nrf_802154_timer_sched_remove_Expect(&m_timeout_timer[window], NULL);
+    nrf_802154_rsch_delayed_timeslot_request_ExpectAndReturn(
+        WINDOW_T0,
+        window_dt_get(window) - RX_SETUP_TIME - RX_RAMP_UP_TIME,
+        timeslot_length,
+        RSCH_PRIO_MAX,
+        (rsch_dly_ts_id_t)(RSCH_DLY_RX + window),
+        true);
+}
+
+static void receive_windows_queue(void)
+{
+    for (uint32_t i = 0; i < NRF_802154_DELAYED_TRX_RX_SLOTS; i++)
+    {
+        window_request_verify(i);
+
+        TEST_ASSERT_TRUE(nrf_802154_delayed_trx_receive(WINDOW_T0,
+                                                        window_dt_get(i),
+                                                        WINDOW_TIMEOUT,
+                                                        window_channel_get(i)));
+    }
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+// Each queued receive window takes its own slot and is scheduled with the same setup offset.
+void test_ReceiveWindowsAreQueuedInSeparateSlots(void)
+{
+    receive_windows_queue();
+
+    for (uint32_t i = 0; i < NRF_802154_DELAYED_TRX_RX_SLOTS; i++)
+    {
+        TEST_ASSERT_EQUAL(DELAYED_TRX_OP_STATE_PENDING, m_dly_op_state[RSCH_DLY_RX + i]);
+        TEST_ASSERT_EQUAL_UINT8(window_channel_get(i), m_rx_channel[i]);
+        TEST_ASSERT_EQUAL_UINT32(WINDOW_TIMEOUT + RX_RAMP_UP_TIME, m_timeout_timer[i].dt);
+        TEST_ASSERT_EQUAL_PTR((void *)(RSCH_DLY_RX + i), m_timeout_timer[i].p_context);
+    }
+
+    TEST_ASSERT_TRUE(nrf_802154_delayed_trx_receive(WINDOW_T0, 0, WINDOW_TIMEOUT, 11) == false);
+}
+
+// Each periodic receive window is requested relative to the base time, so a late start or a late
+// timeout of the previous windows does not shift the following ones.
+void test_PeriodicReceiveWindowsDoNotAccumulateLatency(void)
+{
+    uint32_t windows         = 8;
+    uint32_t dt              = WINDOW_PERIOD - RX_SETUP_TIME - RX_RAMP_UP_TIME;
+    uint16_t timeslot_length = WINDOW_TIMEOUT + nrf_802154_rx_duration_get(MAX_PACKET_SIZE, true);
+    uint32_t latency         = 0;
+
+    nrf_802154_timer_sched_remove_Expect(&m_timeout_timer[0], NULL);
+    nrf_802154_rsch_delayed_timeslot_request_ExpectAndReturn(WINDOW_T0,
+                                                             dt,
+                                                             timeslot_length,
+                                                             RSCH_PRIO_MAX,
+                                                             RSCH_DLY_RX,
+                                                             true);
+
+    TEST_ASSERT_TRUE(nrf_802154_delayed_trx_receive_periodic(WINDOW_T0,
+                                                             WINDOW_PERIOD,
+                                                             WINDOW_TIMEOUT,
+                                                             11,
+                                                             windows));
+
+    nrf_802154_timer_sched_time_is_in_future_IgnoreAndReturn(false);
+
+    for (uint32_t window = 0; window < windows; window++)
+    {
+        // Every window starts and ends later than the previous one did.
+        uint32_t now = WINDOW_T0 + window * WINDOW_PERIOD + dt + latency;
+
+        latency += WINDOW_LATENCY;
+
+        nrf_802154_pib_channel_set_Expect(11);
+        nrf_802154_request_channel_update_ExpectAndReturn(true);
+        nrf_802154_request_receive_ExpectAndReturn(NRF_802154_TERM_802154,
+                                                   REQ_ORIG_DELAYED_TRX,
+                                                   rx_timeslot_started_callback,
+                                                   true,
+                                                   true);
+
+        nrf_802154_rsch_delayed_timeslot_started(RSCH_DLY_RX);
+
+        nrf_802154_timer_coord_time_get_ExpectAnyArgsAndReturn(false);
+        nrf_802154_timer_sched_time_get_ExpectAndReturn(now);
+        nrf_802154_timer_sched_add_ExpectAndReturn(&m_timeout_timer[0], true, true);
+
+        rx_timeslot_started_callback(true);
+
+        nrf_802154_timer_sched_time_get_ExpectAndReturn(now + m_timeout_timer[0].dt + latency);
+
+        if (window + 1 < windows)
+        {
+            nrf_802154_rsch_delayed_timeslot_request_ExpectAndReturn(
+                WINDOW_T0 + (window + 1) * WINDOW_PERIOD,
+                dt,
+                timeslot_length,
+                RSCH_PRIO_MAX,
+                RSCH_DLY_RX,
+                true);
+        }
+        else
+        {
+            nrf_802154_notify_receive_failed_Expect(NRF_802154_RX_ERROR_DELAYED_TIMEOUT);
+        }
+
+        notify_rx_timeout(m_timeout_timer[0].p_context);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(WINDOW_T0 + (windows - 1) * WINDOW_PERIOD, m_rx_t0[0]);
+    TEST_ASSERT_EQUAL(DELAYED_TRX_OP_STATE_STOPPED, m_dly_op_state[RSCH_DLY_RX]);
+}
+
+// A denied timeslot is reported with the frame of the TX slot that started.
+void test_DeniedTransmitSlotReportsItsOwnFrame(void)
+{
+    uint8_t frames[NRF_802154_DELAYED_TRX_TX_SLOTS][4] = {{3, 0x41, 0x98, 0x00}, {3, 0x41, 0x98, 0x01}};
+
+    for (uint32_t i = 0; i < NRF_802154_DELAYED_TRX_TX_SLOTS; i++)
+    {
+        nrf_802154_rsch_delayed_timeslot_request_IgnoreAndReturn(true);
+
+        TEST_ASSERT_TRUE(nrf_802154_delayed_trx_transmit(frames[i],
+                                                         false,
+                                                         WINDOW_T0,
+                                                         window_dt_get(i),
+                                                         11 + i));
+    }
+
+    TEST_ASSERT_TRUE(nrf_802154_delayed_trx_transmit(frames[0], false, WINDOW_T0, 0, 11) == false);
+
+    nrf_802154_pib_channel_set_Expect(12);
+    nrf_802154_request_channel_update_ExpectAndReturn(false);
+    nrf_802154_notify_transmit_failed_Expect(frames[1], NRF_802154_TX_ERROR_TIMESLOT_DENIED);
+
+    nrf_802154_rsch_delayed_timeslot_started((rsch_dly_ts_id_t)(RSCH_DLY_TX + 1));
+
+    TEST_ASSERT_EQUAL(DELAYED_TRX_OP_STATE_PENDING, m_dly_op_state[RSCH_DLY_TX]);
+    TEST_ASSERT_EQUAL(DELAYED_TRX_OP_STATE_STOPPED, m_dly_op_state[RSCH_DLY_TX + 1]);
+}
+
+// Periodic receive windows are re-armed relative to the base time when a window ends, missed
+// windows are skipped and only the end of the last window is reported.
+void test_PeriodicReceiveWindowsAreRearmedWithoutNotification(void)
+{
+    uint32_t dt              = WINDOW_PERIOD - RX_SETUP_TIME - RX_RAMP_UP_TIME;
+    uint16_t timeslot_length = WINDOW_TIMEOUT + nrf_802154_rx_duration_get(MAX_PACKET_SIZE, true);
+    uint32_t now;
+
+    nrf_802154_timer_sched_remove_Expect(&m_timeout_timer[0], NULL);
+    nrf_802154_rsch_delayed_timeslot_request_ExpectAndReturn(WINDOW_T0,
+                                                             dt,
+                                                             timeslot_length,
+                                                             RSCH_PRIO_MAX,
+                                                             RSCH_DLY_RX,
+                                                             true);
+
+    TEST_ASSERT_TRUE(nrf_802154_delayed_trx_receive_periodic(WINDOW_T0,
+                                                             WINDOW_PERIOD,
+                                                             WINDOW_TIMEOUT,
+                                                             11,
+                                                             3));
+
+    for (uint32_t window = 0; window < 2; window++)
+    {
+        now = m_rx_t0[0] + dt;
+
+        nrf_802154_pib_channel_set_Expect(11);
+        nrf_802154_request_channel_update_ExpectAndReturn(true);
+        nrf_802154_request_receive_ExpectAndReturn(NRF_802154_TERM_802154,
+                                                   REQ_ORIG_DELAYED_TRX,
+                                                   rx_timeslot_started_callback,
+                                                   true,
+                                                   true);
+
+        nrf_802154_rsch_delayed_timeslot_started(RSCH_DLY_RX);
+
+        nrf_802154_timer_coord_time_get_ExpectAnyArgsAndReturn(false);
+        nrf_802154_timer_sched_time_get_ExpectAndReturn(now);
+        nrf_802154_timer_sched_add_ExpectAndReturn(&m_timeout_timer[0], true, true);
+
+        rx_timeslot_started_callback(true);
+
+        nrf_802154_timer_sched_time_get_ExpectAndReturn(now + m_timeout_timer[0].dt);
+        nrf_802154_timer_sched_time_is_in_future_IgnoreAndReturn(false);
+
+        if (window == 0)
+        {
+            // The second window is missed and the third one is scheduled instead.
+            nrf_802154_rsch_delayed_timeslot_request_ExpectAndReturn(WINDOW_T0 + WINDOW_PERIOD,
+                                                                     dt,
+                                                                     timeslot_length,
+                                                                     RSCH_PRIO_MAX,
+                                                                     RSCH_DLY_RX,
+                                                                     false);
+            nrf_802154_rsch_delayed_timeslot_request_ExpectAndReturn(WINDOW_T0 + 2 * WINDOW_PERIOD,
+                                                                     dt,
+                                                                     timeslot_length,
+                                                                     RSCH_PRIO_MAX,
+                                                                     RSCH_DLY_RX,
+                                                                     true);
+        }
+        else
+        {
+            nrf_802154_notify_receive_failed_Expect(NRF_802154_RX_ERROR_DELAYED_TIMEOUT);
+        }
+
+        notify_rx_timeout(m_timeout_timer[0].p_context);
+
+        if (window == 0)
+        {
+            TEST_ASSERT_EQUAL(DELAYED_TRX_OP_STATE_PENDING, m_dly_op_state[RSCH_DLY_RX]);
+            TEST_ASSERT_EQUAL_UINT32(WINDOW_T0 + 2 * WINDOW_PERIOD, m_rx_t0[0]);
+            TEST_ASSERT_EQUAL_UINT32(WINDOW_TIMEOUT + RX_RAMP_UP_TIME, m_timeout_timer[0].dt);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(DELAYED_TRX_OP_STATE_STOPPED, m_dly_op_state[RSCH_DLY_RX]);
+}
+
+static void setup_time_sample_add(uint32_t ts_start, uint32_t setup_time)
+{
+    uint32_t now = ts_start + setup_time;
+
+    nrf_802154_timer_coord_time_get_ExpectAnyArgsAndReturn(true);
+    nrf_802154_timer_coord_time_get_ReturnThruPtr_p_time(&now);
+
+    setup_time_measure(&m_tx_setup_time, TX_SETUP_TIME, TX_SETUP_TIME_MARGIN, ts_start);
+}
+
+// The measured setup time is used once enough measurements are collected and it covers
+// the configured percentile of the measurements instead of the longest one.
+void test_SetupTimeIsCalibratedToPercentileOfMeasurements(void)
+{
+    nrf_802154_setup_time_t data;
+
+    for (uint32_t i = 0; i < NRF_802154_DELAYED_TRX_SETUP_TIME_MIN_SAMPLES - 1; i++)
+    {
+        setup_time_sample_add(WINDOW_T0 + i * WINDOW_PERIOD, 50);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(TX_SETUP_TIME, setup_time_get(&m_tx_setup_time, TX_SETUP_TIME));
+
+    for (uint32_t i = NRF_802154_DELAYED_TRX_SETUP_TIME_MIN_SAMPLES - 1; i < 99; i++)
+    {
+        setup_time_sample_add(WINDOW_T0 + i * WINDOW_PERIOD, 50);
+    }
+
+    // Single outlier above the percentile.
+    setup_time_sample_add(WINDOW_T0, 300);
+
+    nrf_802154_delayed_trx_tx_setup_time_get(&data);
+
+    TEST_ASSERT_EQUAL_UINT32(100, data.samples);
+    TEST_ASSERT_EQUAL_UINT32(300, data.max);
+    TEST_ASSERT_EQUAL_UINT32(99, data.histogram[50 / NRF_802154_SETUP_TIME_HISTOGRAM_BIN_WIDTH]);
+    TEST_ASSERT_EQUAL_UINT32(1, data.histogram[300 / NRF_802154_SETUP_TIME_HISTOGRAM_BIN_WIDTH]);
+    TEST_ASSERT_EQUAL_UINT32(7 * NRF_802154_SETUP_TIME_HISTOGRAM_BIN_WIDTH + TX_SETUP_TIME_MARGIN,
+                             data.setup_time);
+}
@@ -0,0 +1,443 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "nrf.h"
+#include "nrf_802154_const.h"
+
+#include "mac_features/nrf_802154_frame_parser.c"
+#include "mac_features/nrf_802154_filter.c"
+#include "mac_features/ack_generator/nrf_802154_enh_ack_generator.c"
+
+#define FUZZ_SEED             0x802154 // Seed making the fuzzed frames reproducible.
+#define FUZZ_ITERATIONS       20000    // Number of fuzzed frames.
+#define FUZZ_MAX_MUTATIONS    4        // Maximum number of mutations applied to a corpus frame.
+#define THROUGHPUT_ITERATIONS 1000     // Number of times the corpus is processed in the benchmark.
+#define MAX_PREPARE_CALLS     8        // Limit of ACK preparation steps for a single frame.
+
+/***********************************************************************************/
+/****************************** FRAME CORPUS ***************************************/
+/***********************************************************************************/
+
+typedef struct
+{
+    const uint8_t * p_frame;
+    uint8_t         size;
+} corpus_entry_t;
+
+// Zigbee NWK data frame, short addresses, PAN ID compression.
+static const uint8_t m_zigbee_data[] =
+{
+    21, 0x41, 0x88, 0x5a, 0xce, 0xfa, 0x00, 0xfc, 0x6f, 0x79,
+    0x08, 0x02, 0x00, 0x00, 0x6f, 0x79, 0x1e, 0x0a, 0x00, 0x01,
+    0x00, 0x00
+};
+
+// Zigbee beacon request.
+static const uint8_t m_zigbee_beacon_req[] =
+{
+    10, 0x03, 0x08, 0x01, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00
+};
+
+// Thread data request command, secured with key identifier mode 1.
+static const uint8_t m_thread_data_req[] =
+{
+    28, 0x6b, 0xd8, 0x33, 0xce, 0xfa, 0x00, 0xfc, 0x11, 0x22,
+    0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x0d, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x04, 0xa1, 0xa2, 0xa3, 0xa4, 0x00, 0x00
+};
+
+// Thread secured 6LoWPAN data frame, extended addresses.
+static const uint8_t m_thread_data[] =
+{
+    45, 0x69, 0xdc, 0x34, 0xce, 0xfa, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66,
+    0x77, 0x88, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x01, 0x7a, 0x33,
+    0x3a, 0x80, 0x00, 0xbe, 0xef, 0x00, 0x01, 0x00, 0x02, 0x03,
+    0x04, 0xa1, 0xa2, 0xa3, 0xa4, 0x00, 0x00
+};
+
+// Thread MLE advertisement, broadcast.
+static const uint8_t m_thread_mle[] =
+{
+    37, 0x41, 0xd8, 0x35, 0xce, 0xfa, 0xff, 0xff, 0x11, 0x22,
+    0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x7f, 0x33, 0xf0, 0x4d,
+    0x4c, 0x4d, 0x4c, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Thread 1.2 secured data frame with CSL header IE, frame version 2.
+static const uint8_t m_thread_csl[] =
+{
+    49, 0x69, 0xee, 0x36, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88,
+    0x0d, 0x03, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0d, 0x10, 0x00,
+    0x20, 0x00, 0x00, 0x3f, 0x7a, 0x33, 0x3a, 0x80, 0x00, 0xbe,
+    0xef, 0x00, 0x01, 0x00, 0xa1, 0xa2, 0xa3, 0xa4, 0x00, 0x00
+};
+
+// Imm-Ack.
+static const uint8_t m_imm_ack[] =
+{
+    5, 0x02, 0x00, 0x33, 0x00, 0x00
+};
+
+static const corpus_entry_t m_corpus[] =
+{
+    {m_zigbee_data,       sizeof(m_zigbee_data)      },
+    {m_zigbee_beacon_req, sizeof(m_zigbee_beacon_req)},
+    {m_thread_data_req,   sizeof(m_thread_data_req)  },
+    {m_thread_data,       sizeof(m_thread_data)      },
+    {m_thread_mle,        sizeof(m_thread_mle)       },
+    {m_thread_csl,        sizeof(m_thread_csl)       },
+    {m_imm_ack,           sizeof(m_imm_ack)          },
+};
+
+#define CORPUS_SIZE (sizeof(m_corpus) / sizeof(m_corpus[0]))
+
+/***********************************************************************************/
+/****************************** DEPENDENCIES ***************************************/
+/***********************************************************************************/
+
+static const uint8_t m_pan_id[PAN_ID_SIZE]             = {0xce, 0xfa};
+static const uint8_t m_short_addr[SHORT_ADDRESS_SIZE]  = {0x00, 0xfc};
+static const uint8_t m_ext_addr[EXTENDED_ADDRESS_SIZE] = {0x01, 0x02, 0x03, 0x04,
+                                                          0x05, 0x06, 0x07, 0x08};
+static const uint8_t m_ie_data[]                       = {0x04, 0x0d, 0x10, 0x00, 0x20, 0x00};
+
+static uint8_t m_frame[MAX_PACKET_SIZE + PHR_SIZE];
+static uint8_t m_ack[MAX_PACKET_SIZE + PHR_SIZE];
+
+bool nrf_802154_pib_pan_coord_get(void)
+{
+    return false;
+}
+
+const uint8_t * nrf_802154_pib_pan_id_get(void)
+{
+    return m_pan_id;
+}
+
+const uint8_t * nrf_802154_pib_short_address_get(void)
+{
+    return m_short_addr;
+}
+
+const uint8_t * nrf_802154_pib_extended_address_get(void)
+{
+    return m_ext_addr;
+}
+
+// Pending bit and IE data depend on the source address, so that all ACK variants are created.
+const uint8_t * nrf_802154_ack_data_get(const uint8_t                            * p_frame,
+                                        const nrf_802154_frame_parser_mhr_data_t * p_mhr_fields,
+                                        bool                                     * p_pending_bit,
+                                        uint8_t                                  * p_ie_length)
+{
+    uint8_t src = (p_mhr_fields->p_src_addr != NULL) ? p_mhr_fields->p_src_addr[0] : 0;
+
+    (void)p_frame;
+
+    *p_pending_bit = (src & 0x01) ? true : false;
+    *p_ie_length   = sizeof(m_ie_data);
+
+    return (src & 0x02) ? m_ie_data : NULL;
+}
+
+/***********************************************************************************/
+/********************************* HELPERS *****************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+    srand(FUZZ_SEED);
+    nrf_802154_enh_ack_generator_init();
+}
+
+void tearDown(void)
+{
+
+}
+
+static void frame_mutate(void)
+{
+    uint8_t mutations = 1 + rand() % FUZZ_MAX_MUTATIONS;
+
+    for (uint8_t i = 0; i < mutations; i++)
+    {
+        // Mutations are focused on the MAC header, which drives the parser and the filter.
+        uint8_t header_offset = rand() % (PHR_SIZE + FCF_SIZE + 32);
+        uint8_t offset        = rand() % sizeof(m_frame);
+
+        switch (rand() % 4)
+        {
+            case 0:
+                m_frame[header_offset] ^= 1 << (rand() % 8);
+                break;
+
+            case 1:
+                m_frame[header_offset] = rand();
+                break;
+
+            case 2:
+                m_frame[offset] = rand();
+                break;
+
+            default:
+                m_frame[0] = rand() % sizeof(m_frame);
+                break;
+        }
+    }
+}
+
+static void frame_generate(void)
+{
+    const corpus_entry_t * p_entry = &m_corpus[rand() % CORPUS_SIZE];
+
+    memset(m_frame, 0, sizeof(m_frame));
+
+    if (rand() % 16)
+    {
+        memcpy(m_frame, p_entry->p_frame, p_entry->size);
+    }
+    else
+    {
+        for (uint32_t i = 0; i < sizeof(m_frame); i++)
+        {
+            m_frame[i] = rand();
+        }
+    }
+
+    frame_mutate();
+}
+
+static void offset_verify(uint8_t offset)
+{
+    if (offset != NRF_802154_FRAME_PARSER_INVALID_OFFSET)
+    {
+        TEST_ASSERT_TRUE(offset < sizeof(m_frame));
+    }
+}
+
+static void field_verify(const uint8_t * p_field, uint8_t size)
+{
+    if (p_field != NULL)
+    {
+        TEST_ASSERT_TRUE(p_field >= m_frame);
+        TEST_ASSERT_TRUE(p_field + size <= m_frame + sizeof(m_frame));
+    }
+}
+
+static bool frame_parse_verify(nrf_802154_frame_parser_mhr_data_t * p_mhr)
+{
+    bool extended;
+
+    offset_verify(nrf_802154_frame_parser_dst_panid_offset_get(m_frame));
+    offset_verify(nrf_802154_frame_parser_dst_addr_offset_get(m_frame));
+    offset_verify(nrf_802154_frame_parser_dst_addr_end_offset_get(m_frame));
+    offset_verify(nrf_802154_frame_parser_src_panid_offset_get(m_frame));
+    offset_verify(nrf_802154_frame_parser_src_addr_offset_get(m_frame));
+    offset_verify(nrf_802154_frame_parser_addressing_end_offset_get(m_frame));
+    offset_verify(nrf_802154_frame_parser_sec_ctrl_offset_get(m_frame));
+    offset_verify(nrf_802154_frame_parser_key_id_offset_get(m_frame));
+    offset_verify(nrf_802154_frame_parser_ie_header_offset_get(m_frame));
+
+    field_verify(nrf_802154_frame_parser_dst_addr_get(m_frame, &extended), EXTENDED_ADDRESS_SIZE);
+    field_verify(nrf_802154_frame_parser_src_addr_get(m_frame, &extended), EXTENDED_ADDRESS_SIZE);
+    field_verify(nrf_802154_frame_parser_key_id_get(m_frame), KEY_ID_MODE_3_SIZE);
+
+    if (!nrf_802154_frame_parser_mhr_parse(m_frame, p_mhr))
+    {
+        return false;
+    }
+
+    field_verify(p_mhr->p_dst_panid, PAN_ID_SIZE);
+    field_verify(p_mhr->p_dst_addr, p_mhr->dst_addr_size);
+    field_verify(p_mhr->p_src_panid, PAN_ID_SIZE);
+    field_verify(p_mhr->p_src_addr, p_mhr->src_addr_size);
+    field_verify(p_mhr->p_sec_ctrl, SECURITY_CONTROL_SIZE);
+    offset_verify(p_mhr->addressing_end_offset);
+
+    return true;
+}
+
+// Filter the frame in parts, the same way as the core does during reception.
+static bool frame_filter_verify(uint8_t * p_num_bytes)
+{
+    uint8_t               prev_num_bytes = 0;
+    nrf_802154_rx_error_t result         = NRF_802154_RX_ERROR_NONE;
+
+    *p_num_bytes = PHR_SIZE + FCF_SIZE;
+
+    while ((result == NRF_802154_RX_ERROR_NONE) && (*p_num_bytes != prev_num_bytes))
+    {
+        prev_num_bytes = *p_num_bytes;
+        result         = nrf_802154_filter_frame_part(m_frame, p_num_bytes);
+
+        TEST_ASSERT_TRUE(*p_num_bytes >= prev_num_bytes);
+        TEST_ASSERT_TRUE(*p_num_bytes <= sizeof(m_frame));
+    }
+
+    return result == NRF_802154_RX_ERROR_NONE;
+}
+
+// Create Enh-Ack at once and in stages and verify that both ACKs are the same.
+static void enh_ack_verify(const nrf_802154_frame_parser_mhr_data_t * p_mhr, uint8_t num_bytes)
+{
+    const uint8_t * p_ack;
+    uint8_t         prev_num_bytes;
+    uint8_t         calls = 0;
+
+    p_ack = nrf_802154_enh_ack_generator_create(m_frame, p_mhr);
+
+    if (p_ack == NULL)
+    {
+        return;
+    }
+
+    TEST_ASSERT_TRUE(p_ack[0] <= MAX_PACKET_SIZE);
+    memcpy(m_ack, p_ack, p_ack[0] + PHR_SIZE);
+
+    do
+    {
+        prev_num_bytes = num_bytes;
+        nrf_802154_enh_ack_generator_prepare(m_frame, p_mhr, &num_bytes);
+
+        TEST_ASSERT_TRUE(num_bytes <= sizeof(m_frame));
+    }
+    while ((num_bytes != prev_num_bytes) && (++calls < MAX_PREPARE_CALLS));
+
+    TEST_ASSERT_TRUE(calls < MAX_PREPARE_CALLS);
+
+    p_ack = nrf_802154_enh_ack_generator_finalize(m_frame, p_mhr);
+
+    TEST_ASSERT_NOT_NULL(p_ack);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(m_ack, p_ack, m_ack[0] + PHR_SIZE);
+}
+
+static void frame_process_verify(void)
+{
+    nrf_802154_frame_parser_mhr_data_t mhr;
+    uint8_t                            num_bytes;
+    bool                               parsed;
+
+    parsed = frame_parse_verify(&mhr);
+
+    if (!frame_filter_verify(&num_bytes) || !parsed)
+    {
+        return;
+    }
+
+    if ((m_frame[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK) == FRAME_VERSION_2)
+    {
+        enh_ack_verify(&mhr, num_bytes);
+    }
+}
+
+/***********************************************************************************/
+/*********************************** TESTS *****************************************/
+/***********************************************************************************/
+
+// Every frame of the corpus other than ACK is accepted by the filter, parsed and answered
+// correctly.
+void test_CorpusFramesShallBeProcessed(void)
+{
+    nrf_802154_frame_parser_mhr_data_t mhr;
+    uint8_t                            num_bytes;
+
+    for (uint32_t i = 0; i < CORPUS_SIZE; i++)
+    {
+        memset(m_frame, 0, sizeof(m_frame));
+        memcpy(m_frame, m_corpus[i].p_frame, m_corpus[i].size);
+
+        if ((m_frame[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK)
+        {
+            TEST_ASSERT_TRUE(frame_filter_verify(&num_bytes));
+            TEST_ASSERT_TRUE(frame_parse_verify(&mhr));
+        }
+
+        frame_process_verify();
+    }
+}
+
+// Mutated and random frames never make the parser, the filter or the ACK generator access data
+// outside of the frame buffer, and the Enh-Ack created in stages is the same as the one created
+// at once.
+void test_MutatedFramesShallBeProcessedWithinFrameBuffer(void)
+{
+    for (uint32_t i = 0; i < FUZZ_ITERATIONS; i++)
+    {
+        frame_generate();
+        frame_process_verify();
+    }
+}
+
+// Measures the number of frames parsed and filtered per second by the CPU.
+void test_FrameProcessingThroughput(void)
+{
+    nrf_802154_frame_parser_mhr_data_t mhr;
+    uint8_t                            num_bytes;
+    uint32_t                           start;
+    uint32_t                           cycles;
+    uint32_t                           frames = THROUGHPUT_ITERATIONS * CORPUS_SIZE;
+    char                               message[64];
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+    start = DWT->CYCCNT;
+
+    for (uint32_t i = 0; i < THROUGHPUT_ITERATIONS; i++)
+    {
+        for (uint32_t j = 0; j < CORPUS_SIZE; j++)
+        {
+            memcpy(m_frame, m_corpus[j].p_frame, m_corpus[j].size);
+
+            (void)nrf_802154_frame_parser_mhr_parse(m_frame, &mhr);
+            (void)frame_filter_verify(&num_bytes);
+        }
+    }
+
+    cycles = DWT->CYCCNT - start;
+
+    if (cycles == 0)
+    {
+        TEST_IGNORE_MESSAGE("Cycle counter is not available.");
+    }
+
+    snprintf(message, sizeof(message), "%lu cycles per frame, %lu frames/s",
+             (unsigned long)(cycles / frames),
+             (unsigned long)(((uint64_t)frames * SystemCoreClock) / cycles));
+    TEST_MESSAGE(message);
+}
@@ -0,0 +1,224 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include "nrf_802154_const.h"
+
+#include "mac_features/nrf_802154_frame_parser.c"
+
+#define FCF_DATA_COMPR       0x41 // Data frame, PAN ID compression.
+#define FCF_DATA             0x01 // Data frame.
+#define FCF_DATA_SECURED     0x09 // Data frame, security enabled.
+
+#define FCF_2006_SHORT_EXT   0xc8 // Frame version 0, short destination, extended source.
+#define FCF_2006_EXT_SHORT   0x8c // Frame version 0, extended destination, short source.
+#define FCF_2015_EXT_EXT     0xec // Frame version 2, extended destination and source.
+#define FCF_2015_SHORT_SHORT 0xa8 // Frame version 2, short destination and source.
+#define FCF_2015_NONE_NONE   0x20 // Frame version 2, no addresses.
+
+static uint8_t m_frame[MAX_PACKET_SIZE + 1];
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+    memset(m_frame, 0, sizeof(m_frame));
+    m_frame[0] = MAX_PACKET_SIZE;
+}
+
+void tearDown(void)
+{
+
+}
+
+static void fcf_set(uint8_t fcf_0, uint8_t fcf_1)
+{
+    m_frame[1] = fcf_0;
+    m_frame[2] = fcf_1;
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+// In 2006 frames with PAN ID compression only the destination PAN ID is present.
+void test_Frame2006WithPanIdCompressionShallHaveOnlyDestinationPanId(void)
+{
+    nrf_802154_frame_parser_mhr_data_t mhr;
+
+    fcf_set(FCF_DATA_COMPR, FCF_2006_SHORT_EXT);
+
+    TEST_ASSERT_EQUAL_UINT8(4, nrf_802154_frame_parser_dst_panid_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(6, nrf_802154_frame_parser_dst_addr_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(8, nrf_802154_frame_parser_dst_addr_end_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(4, nrf_802154_frame_parser_src_panid_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(8, nrf_802154_frame_parser_src_addr_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(16, nrf_802154_frame_parser_addressing_end_offset_get(m_frame));
+
+    TEST_ASSERT_TRUE(nrf_802154_frame_parser_mhr_parse(m_frame, &mhr));
+    TEST_ASSERT_EQUAL_PTR(&m_frame[4], mhr.p_dst_panid);
+    TEST_ASSERT_EQUAL_PTR(&m_frame[6], mhr.p_dst_addr);
+    TEST_ASSERT_EQUAL_UINT8(SHORT_ADDRESS_SIZE, mhr.dst_addr_size);
+    TEST_ASSERT_EQUAL_PTR(&m_frame[4], mhr.p_src_panid);
+    TEST_ASSERT_EQUAL_PTR(&m_frame[8], mhr.p_src_addr);
+    TEST_ASSERT_EQUAL_UINT8(EXTENDED_ADDRESS_SIZE, mhr.src_addr_size);
+    TEST_ASSERT_EQUAL_UINT8(16, mhr.addressing_end_offset);
+    TEST_ASSERT_NULL(mhr.p_sec_ctrl);
+}
+
+// In 2006 frames without PAN ID compression both PAN IDs are present.
+void test_Frame2006WithoutPanIdCompressionShallHaveBothPanIds(void)
+{
+    fcf_set(FCF_DATA, FCF_2006_EXT_SHORT);
+
+    TEST_ASSERT_EQUAL_UINT8(4, nrf_802154_frame_parser_dst_panid_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(6, nrf_802154_frame_parser_dst_addr_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(14, nrf_802154_frame_parser_dst_addr_end_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(14, nrf_802154_frame_parser_src_panid_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(16, nrf_802154_frame_parser_src_addr_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(18, nrf_802154_frame_parser_addressing_end_offset_get(m_frame));
+}
+
+// In 2015 frames with two extended addresses and no PAN ID compression only the destination
+// PAN ID is present.
+void test_Frame2015WithExtendedAddressesShallHaveOnlyDestinationPanId(void)
+{
+    fcf_set(FCF_DATA, FCF_2015_EXT_EXT);
+
+    TEST_ASSERT_EQUAL_UINT8(4, nrf_802154_frame_parser_dst_panid_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(6, nrf_802154_frame_parser_dst_addr_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(4, nrf_802154_frame_parser_src_panid_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(14, nrf_802154_frame_parser_src_addr_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(22, nrf_802154_frame_parser_addressing_end_offset_get(m_frame));
+}
+
+// In 2015 frames with no addresses and PAN ID compression set the destination PAN ID is present.
+void test_Frame2015WithoutAddressesShallHaveDestinationPanIdIfCompressionIsSet(void)
+{
+    nrf_802154_frame_parser_mhr_data_t mhr;
+
+    fcf_set(FCF_DATA_COMPR, FCF_2015_NONE_NONE);
+
+    TEST_ASSERT_TRUE(nrf_802154_frame_parser_mhr_parse(m_frame, &mhr));
+    TEST_ASSERT_EQUAL_PTR(&m_frame[4], mhr.p_dst_panid);
+    TEST_ASSERT_NULL(mhr.p_dst_addr);
+    TEST_ASSERT_EQUAL_UINT8(0, mhr.dst_addr_size);
+    TEST_ASSERT_EQUAL_PTR(&m_frame[4], mhr.p_src_panid);
+    TEST_ASSERT_NULL(mhr.p_src_addr);
+    TEST_ASSERT_EQUAL_UINT8(0, mhr.src_addr_size);
+    TEST_ASSERT_EQUAL_UINT8(6, mhr.addressing_end_offset);
+}
+
+// Suppressing the sequence number moves all addressing fields by one byte.
+void test_Frame2015WithSuppressedSequenceNumberShallHaveFieldsMoved(void)
+{
+    fcf_set(FCF_DATA_COMPR, FCF_2015_SHORT_SHORT | DSN_SUPPRESS_BIT);
+
+    TEST_ASSERT_EQUAL_UINT8(3, nrf_802154_frame_parser_dst_panid_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(5, nrf_802154_frame_parser_dst_addr_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(3, nrf_802154_frame_parser_src_panid_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(7, nrf_802154_frame_parser_src_addr_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(9, nrf_802154_frame_parser_addressing_end_offset_get(m_frame));
+}
+
+// The sequence number suppression bit is ignored in 2006 frames.
+void test_Frame2006ShallIgnoreSequenceNumberSuppressionBit(void)
+{
+    fcf_set(FCF_DATA_COMPR, FCF_2006_SHORT_EXT | DSN_SUPPRESS_BIT);
+
+    TEST_ASSERT_EQUAL_UINT8(4, nrf_802154_frame_parser_dst_panid_offset_get(m_frame));
+    TEST_ASSERT_EQUAL_UINT8(16, nrf_802154_frame_parser_addressing_end_offset_get(m_frame));
+}
+
+// Security control field follows the addressing fields.
+void test_SecuredFrameShallHaveSecurityControlAfterAddressing(void)
+{
+    nrf_802154_frame_parser_mhr_data_t mhr;
+
+    fcf_set(FCF_DATA_SECURED | PAN_ID_COMPR_MASK, FCF_2006_SHORT_EXT);
+
+    TEST_ASSERT_EQUAL_UINT8(16, nrf_802154_frame_parser_sec_ctrl_offset_get(m_frame));
+    TEST_ASSERT_TRUE(nrf_802154_frame_parser_mhr_parse(m_frame, &mhr));
+    TEST_ASSERT_EQUAL_PTR(&m_frame[16], mhr.p_sec_ctrl);
+}
+
+// Frames with a reserved addressing mode cannot be parsed.
+void test_FrameWithReservedAddressingModeShallNotBeParsed(void)
+{
+    nrf_802154_frame_parser_mhr_data_t mhr;
+
+    fcf_set(FCF_DATA_COMPR, (FCF_2006_SHORT_EXT & ~DEST_ADDR_TYPE_MASK) | 0x04);
+
+    TEST_ASSERT_EQUAL_UINT8(NRF_802154_FRAME_PARSER_INVALID_OFFSET,
+                            nrf_802154_frame_parser_addressing_end_offset_get(m_frame));
+    TEST_ASSERT_FALSE(nrf_802154_frame_parser_mhr_parse(m_frame, &mhr));
+
+    fcf_set(FCF_DATA_COMPR, (FCF_2015_SHORT_SHORT & ~SRC_ADDR_TYPE_MASK) | 0x40);
+
+    TEST_ASSERT_EQUAL_UINT8(NRF_802154_FRAME_PARSER_INVALID_OFFSET,
+                            nrf_802154_frame_parser_addressing_end_offset_get(m_frame));
+    TEST_ASSERT_FALSE(nrf_802154_frame_parser_mhr_parse(m_frame, &mhr));
+}
+
+// Fields located by the parser never overlap and never exceed the maximum MAC header length.
+void test_AllFcfCombinationsShallProduceOrderedOffsets(void)
+{
+    nrf_802154_frame_parser_mhr_data_t mhr;
+
+    for (uint32_t fcf = 0; fcf <= UINT16_MAX; fcf++)
+    {
+        fcf_set((uint8_t)fcf, (uint8_t)(fcf >> 8));
+
+        if (!nrf_802154_frame_parser_mhr_parse(m_frame, &mhr))
+        {
+            continue;
+        }
+
+        TEST_ASSERT_TRUE(mhr.addressing_end_offset <= PHR_SIZE + FCF_SIZE + DSN_SIZE +
+                         2 * (PAN_ID_SIZE + EXTENDED_ADDRESS_SIZE));
+
+        if (mhr.p_src_addr != NULL)
+        {
+            TEST_ASSERT_EQUAL_PTR(&m_frame[mhr.addressing_end_offset - mhr.src_addr_size],
+                                  mhr.p_src_addr);
+        }
+
+        if (mhr.p_dst_addr != NULL)
+        {
+            TEST_ASSERT_EQUAL_PTR(
+                &m_frame[nrf_802154_frame_parser_dst_addr_end_offset_get(m_frame) -
+                         mhr.dst_addr_size],
+                mhr.p_dst_addr);
+        }
+    }
+}
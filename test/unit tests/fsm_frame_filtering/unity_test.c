@@ -104,6 +104,7 @@ void setUp(void)
 
     m_flags.frame_filtered        = false;
     m_flags.rx_timeslot_requested = false;
+    m_flags.ack_being_prepared    = false;
 }
 
 void tearDown(void)
@@ -359,7 +360,7 @@ static void mock_ack_requested_rx(void)
     uint32_t  event_addr;
     uint32_t  time_to_pa = rand();
 
-    nrf_802154_ack_generator_create_ExpectAndReturn(m_test_rx_buffer.data, p_ack);
+    nrf_802154_ack_generator_create_ExpectAndReturn(m_test_rx_buffer.data, NULL, p_ack);
     nrf_radio_packetptr_set_Expect(p_ack);
     nrf_radio_shorts_set_Expect(NRF_RADIO_SHORT_TXREADY_START_MASK |
                                 NRF_RADIO_SHORT_PHYEND_DISABLE_MASK);
@@ -706,11 +707,166 @@ void test_OnBcmatchEventStateRx_FrameFilteredFlagShallBeTrueAndStateSetToRxFrame
     nrf_802154_filter_frame_part_IgnoreArg_p_num_bytes();
     nrf_802154_filter_frame_part_ReturnThruPtr_p_num_bytes(&expected_initial_size);
 
+    nrf_802154_frame_parser_mhr_parse_ExpectAndReturn(m_test_rx_buffer.data, &m_test_rx_buffer.mhr, true);
+    nrf_802154_frame_parser_ar_bit_is_set_ExpectAndReturn(m_test_rx_buffer.data, false);
+
     irq_bcmatch_state_rx();
 
     TEST_ASSERT_TRUE(m_flags.frame_filtered);
 }
 
+void test_OnBcmatchEventStateRx_ParsedMhrShallBeCachedInRxBufferIfHeaderPartFilteringSucceeds(void)
+{
+    uint8_t expected_initial_size = PHR_SIZE + FCF_SIZE;
+    uint8_t expected_initial_bcc  = expected_initial_size * 8;
+
+    m_flags.rx_timeslot_requested = true;
+
+    nrf_radio_bcc_get_ExpectAndReturn(expected_initial_bcc);
+    nrf_radio_event_check_ExpectAndReturn(NRF_RADIO_EVENT_CRCERROR, false);
+
+    nrf_802154_filter_frame_part_ExpectAndReturn(m_test_rx_buffer.data, NULL, NRF_802154_RX_ERROR_NONE);
+    nrf_802154_filter_frame_part_IgnoreArg_p_num_bytes();
+    nrf_802154_filter_frame_part_ReturnThruPtr_p_num_bytes(&expected_initial_size);
+
+    nrf_802154_frame_parser_mhr_parse_ExpectAndReturn(m_test_rx_buffer.data, &m_test_rx_buffer.mhr, true);
+    nrf_802154_frame_parser_ar_bit_is_set_ExpectAndReturn(m_test_rx_buffer.data, false);
+
+    irq_bcmatch_state_rx();
+
+    TEST_ASSERT_TRUE(m_test_rx_buffer.mhr_valid);
+    TEST_ASSERT_EQUAL_PTR(&m_test_rx_buffer.mhr, rx_buffer_mhr_get());
+}
+
+void test_OnBcmatchEventStateRx_CachedMhrShallNotBeUsedIfItCouldNotBeParsed(void)
+{
+    uint8_t expected_initial_size = PHR_SIZE + FCF_SIZE;
+    uint8_t expected_initial_bcc  = expected_initial_size * 8;
+
+    m_flags.rx_timeslot_requested = true;
+    m_test_rx_buffer.mhr_valid    = true;
+
+    nrf_radio_bcc_get_ExpectAndReturn(expected_initial_bcc);
+    nrf_radio_event_check_ExpectAndReturn(NRF_RADIO_EVENT_CRCERROR, false);
+
+    nrf_802154_filter_frame_part_ExpectAndReturn(m_test_rx_buffer.data, NULL, NRF_802154_RX_ERROR_NONE);
+    nrf_802154_filter_frame_part_IgnoreArg_p_num_bytes();
+    nrf_802154_filter_frame_part_ReturnThruPtr_p_num_bytes(&expected_initial_size);
+
+    nrf_802154_frame_parser_mhr_parse_ExpectAndReturn(m_test_rx_buffer.data, &m_test_rx_buffer.mhr, false);
+    nrf_802154_frame_parser_ar_bit_is_set_ExpectAndReturn(m_test_rx_buffer.data, false);
+
+    irq_bcmatch_state_rx();
+
+    TEST_ASSERT_FALSE(m_test_rx_buffer.mhr_valid);
+    TEST_ASSERT_NULL(rx_buffer_mhr_get());
+}
+
+void test_OnBcmatchEventStateRx_AckShallBePreparedIfHeaderPartFilteringSucceedsAndAckIsRequested(void)
+{
+    uint8_t expected_initial_size = PHR_SIZE + FCF_SIZE;
+    uint8_t expected_initial_bcc  = expected_initial_size * 8;
+
+    m_flags.rx_timeslot_requested = true;
+    ack_requested_set_rx();
+
+    nrf_radio_bcc_get_ExpectAndReturn(expected_initial_bcc);
+    nrf_radio_event_check_ExpectAndReturn(NRF_RADIO_EVENT_CRCERROR, false);
+
+    nrf_802154_filter_frame_part_ExpectAndReturn(m_test_rx_buffer.data, NULL, NRF_802154_RX_ERROR_NONE);
+    nrf_802154_filter_frame_part_IgnoreArg_p_num_bytes();
+    nrf_802154_filter_frame_part_ReturnThruPtr_p_num_bytes(&expected_initial_size);
+
+    nrf_802154_frame_parser_mhr_parse_ExpectAndReturn(m_test_rx_buffer.data, &m_test_rx_buffer.mhr, true);
+    nrf_802154_frame_parser_ar_bit_is_set_ExpectAndReturn(m_test_rx_buffer.data, true);
+    nrf_802154_pib_auto_ack_get_ExpectAndReturn(true);
+
+    nrf_802154_ack_generator_prepare_Expect(m_test_rx_buffer.data, &m_test_rx_buffer.mhr, NULL);
+    nrf_802154_ack_generator_prepare_IgnoreArg_p_num_bytes();
+
+    irq_bcmatch_state_rx();
+
+    TEST_ASSERT_TRUE(m_flags.frame_filtered);
+    TEST_ASSERT_FALSE(m_flags.ack_being_prepared);
+}
+
+void test_OnBcmatchEventStateRx_AckShallNotBePreparedIfAckIsRequestedAndAutoAckIsDisabled(void)
+{
+    uint8_t expected_initial_size = PHR_SIZE + FCF_SIZE;
+    uint8_t expected_initial_bcc  = expected_initial_size * 8;
+
+    m_flags.rx_timeslot_requested = true;
+    ack_requested_set_rx();
+
+    nrf_radio_bcc_get_ExpectAndReturn(expected_initial_bcc);
+    nrf_radio_event_check_ExpectAndReturn(NRF_RADIO_EVENT_CRCERROR, false);
+
+    nrf_802154_filter_frame_part_ExpectAndReturn(m_test_rx_buffer.data, NULL, NRF_802154_RX_ERROR_NONE);
+    nrf_802154_filter_frame_part_IgnoreArg_p_num_bytes();
+    nrf_802154_filter_frame_part_ReturnThruPtr_p_num_bytes(&expected_initial_size);
+
+    nrf_802154_frame_parser_mhr_parse_ExpectAndReturn(m_test_rx_buffer.data, &m_test_rx_buffer.mhr, true);
+    nrf_802154_frame_parser_ar_bit_is_set_ExpectAndReturn(m_test_rx_buffer.data, true);
+    nrf_802154_pib_auto_ack_get_ExpectAndReturn(false);
+
+    irq_bcmatch_state_rx();
+
+    TEST_ASSERT_TRUE(m_flags.frame_filtered);
+    TEST_ASSERT_FALSE(m_flags.ack_being_prepared);
+}
+
+void test_OnBcmatchEventStateRx_BccShallBeSetIfAckPreparationNeedsMoreData(void)
+{
+    uint8_t expected_initial_size = PHR_SIZE + FCF_SIZE;
+    uint8_t expected_initial_bcc  = expected_initial_size * 8;
+    uint8_t expected_ack_size     = expected_initial_size + 10;
+
+    m_flags.rx_timeslot_requested = true;
+    ack_requested_set_rx();
+
+    nrf_radio_bcc_get_ExpectAndReturn(expected_initial_bcc);
+    nrf_radio_event_check_ExpectAndReturn(NRF_RADIO_EVENT_CRCERROR, false);
+
+    nrf_802154_filter_frame_part_ExpectAndReturn(m_test_rx_buffer.data, NULL, NRF_802154_RX_ERROR_NONE);
+    nrf_802154_filter_frame_part_IgnoreArg_p_num_bytes();
+    nrf_802154_filter_frame_part_ReturnThruPtr_p_num_bytes(&expected_initial_size);
+
+    nrf_802154_frame_parser_mhr_parse_ExpectAndReturn(m_test_rx_buffer.data, &m_test_rx_buffer.mhr, true);
+    nrf_802154_frame_parser_ar_bit_is_set_ExpectAndReturn(m_test_rx_buffer.data, true);
+    nrf_802154_pib_auto_ack_get_ExpectAndReturn(true);
+
+    nrf_802154_ack_generator_prepare_Expect(m_test_rx_buffer.data, &m_test_rx_buffer.mhr, NULL);
+    nrf_802154_ack_generator_prepare_IgnoreArg_p_num_bytes();
+    nrf_802154_ack_generator_prepare_ReturnThruPtr_p_num_bytes(&expected_ack_size);
+
+    nrf_radio_bcc_set_Expect(expected_ack_size * 8);
+
+    irq_bcmatch_state_rx();
+
+    TEST_ASSERT_TRUE(m_flags.frame_filtered);
+    TEST_ASSERT_TRUE(m_flags.ack_being_prepared);
+}
+
+void test_OnBcmatchEventStateRx_AckPreparationShallBeContinuedIfFrameWasAlreadyFiltered(void)
+{
+    uint8_t expected_size = PHR_SIZE + FCF_SIZE + 10;
+
+    m_flags.frame_filtered        = true;
+    m_flags.rx_timeslot_requested = true;
+    m_flags.ack_being_prepared    = true;
+    m_test_rx_buffer.mhr_valid    = true;
+
+    nrf_radio_bcc_get_ExpectAndReturn(expected_size * 8);
+    nrf_radio_event_check_ExpectAndReturn(NRF_RADIO_EVENT_CRCERROR, false);
+
+    nrf_802154_ack_generator_prepare_Expect(m_test_rx_buffer.data, &m_test_rx_buffer.mhr, NULL);
+    nrf_802154_ack_generator_prepare_IgnoreArg_p_num_bytes();
+
+    irq_bcmatch_state_rx();
+
+    TEST_ASSERT_FALSE(m_flags.ack_being_prepared);
+}
+
 void test_OnBcmatchEventStateRx_TimeslotShouldBeRequested(void)
 {
     uint8_t  expected_size = PHR_SIZE + FCF_SIZE;
@@ -953,6 +1109,9 @@ void test_OnBcmatchEventStateRx_ShallSetPsduBeingReceivedOnSuccessfullFiltration
     nrf_802154_filter_frame_part_IgnoreArg_p_num_bytes();
     nrf_802154_filter_frame_part_ReturnThruPtr_p_num_bytes(&expected_initial_size);
 
+    nrf_802154_frame_parser_mhr_parse_ExpectAndReturn(m_test_rx_buffer.data, &m_test_rx_buffer.mhr, true);
+    nrf_802154_frame_parser_ar_bit_is_set_ExpectAndReturn(m_test_rx_buffer.data, false);
+
     irq_bcmatch_state_rx();
 
     TEST_ASSERT_TRUE(psdu_is_being_received());
@@ -106,6 +106,8 @@ void setUp(void)
 
     m_flags.frame_filtered        = false;
     m_flags.rx_timeslot_requested = false;
+
+    nrf_802154_frame_parser_mhr_parse_IgnoreAndReturn(false);
 }
 
 void tearDown(void)
@@ -312,7 +314,7 @@ static void mock_ack_requested(void)
     uint32_t  event_addr;
     uint32_t  time_to_pa = rand();
 
-    nrf_802154_ack_generator_create_ExpectAndReturn(m_test_radio_buffer.data, p_ack);
+    nrf_802154_ack_generator_create_ExpectAndReturn(m_test_radio_buffer.data, NULL, p_ack);
     nrf_radio_packetptr_set_Expect(p_ack);
     nrf_radio_shorts_set_Expect(NRF_RADIO_SHORT_TXREADY_START_MASK |
                                 NRF_RADIO_SHORT_PHYEND_DISABLE_MASK);
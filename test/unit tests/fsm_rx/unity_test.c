@@ -504,7 +504,7 @@ static void crcok_ack_periph_set_verify(void)
 
     nrf_802154_pib_auto_ack_get_ExpectAndReturn(true);
 
-    nrf_802154_ack_generator_create_ExpectAndReturn(m_buffer.data, p_ack);
+    nrf_802154_ack_generator_create_ExpectAndReturn(m_buffer.data, NULL, p_ack);
     nrf_radio_packetptr_set_Expect(p_ack);
 
     nrf_radio_shorts_set_Expect(NRF_RADIO_SHORT_TXREADY_START_MASK |
@@ -539,7 +539,7 @@ void test_crcok_handler_ShallPreparePeriphsToTransmitAckIfRequested(void)
 
     nrf_802154_pib_auto_ack_get_ExpectAndReturn(true);
 
-    nrf_802154_ack_generator_create_ExpectAndReturn(m_buffer.data, p_ack);
+    nrf_802154_ack_generator_create_ExpectAndReturn(m_buffer.data, NULL, p_ack);
     nrf_radio_packetptr_set_Expect(p_ack);
 
     nrf_radio_shorts_set_Expect(NRF_RADIO_SHORT_TXREADY_START_MASK |
@@ -0,0 +1,190 @@
+/* Copyright (c) 2017 - 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <stdlib.h>
+
+#include "unity.h"
+
+#include "nrf_802154_const.h"
+#include "mock_nrf_802154.h"
+#include "mock_nrf_802154_ack_data.h"
+#include "mock_nrf_802154_core_hooks.h"
+#include "mock_nrf_802154_critical_section.h"
+#include "mock_nrf_802154_debug.h"
+#include "mock_nrf_802154_frame_parser.h"
+#include "mock_nrf_802154_notification.h"
+#include "mock_nrf_802154_pib.h"
+#include "mock_nrf_802154_priority_drop.h"
+#include "mock_nrf_802154_procedures_duration.h"
+#include "mock_nrf_802154_rsch.h"
+#include "mock_nrf_802154_rssi.h"
+#include "mock_nrf_802154_rx_buffer.h"
+#include "mock_nrf_802154_timer_coord.h"
+#include "mock_nrf_fem_protocol_api.h"
+#include "mock_nrf_radio.h"
+#include "mock_nrf_timer.h"
+#include "mock_nrf_egu.h"
+#include "mock_nrf_ppi.h"
+
+#define __ISB()
+#define __LDREXB(ptr)           0
+#define __STREXB(value, ptr)    0
+
+#ifdef NRF_802154_TX_QUEUE_ENABLED
+    #undef NRF_802154_TX_QUEUE_ENABLED
+#endif
+#define NRF_802154_TX_QUEUE_ENABLED 1
+
+#ifdef NRF_802154_TX_QUEUE_SIZE
+    #undef NRF_802154_TX_QUEUE_SIZE
+#endif
+#define NRF_802154_TX_QUEUE_SIZE    2
+
+#include "nrf_802154_core.c"
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+static uint8_t m_tx_buffers[NRF_802154_TX_QUEUE_SIZE + 1][MAX_PACKET_SIZE + 1];
+
+void setUp(void)
+{
+    m_tx_queue_head            = 0;
+    m_tx_queue_count           = 0;
+    m_rsch_timeslot_is_granted = false;
+}
+
+void tearDown(void)
+{
+
+}
+
+static void verify_critical_section_enter(void)
+{
+    nrf_802154_critical_section_enter_ExpectAndReturn(true);
+}
+
+static void verify_critical_section_exit(void)
+{
+    nrf_802154_critical_section_exit_Expect();
+}
+
+static void verify_transmit_failed_notification(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    nrf_802154_core_hooks_tx_failed_ExpectAndReturn(p_frame, error, true);
+    nrf_802154_notify_transmit_failed_Expect(p_frame, error);
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void test_transmit_enqueue_ShallQueueFramesDuringTransmission(void)
+{
+    m_state = RADIO_STATE_TX;
+
+    for (uint32_t i = 0; i < NRF_802154_TX_QUEUE_SIZE; i++)
+    {
+        verify_critical_section_enter();
+        verify_critical_section_exit();
+
+        TEST_ASSERT_TRUE(nrf_802154_core_transmit_enqueue(m_tx_buffers[i], (i % 2) == 0));
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(NRF_802154_TX_QUEUE_SIZE, m_tx_queue_count);
+    TEST_ASSERT_EQUAL(RADIO_STATE_TX, m_state);
+}
+
+void test_transmit_enqueue_ShallFailWhenQueueIsFull(void)
+{
+    m_state = RADIO_STATE_RX_ACK;
+
+    for (uint32_t i = 0; i < NRF_802154_TX_QUEUE_SIZE; i++)
+    {
+        TEST_ASSERT_TRUE(tx_queue_push(m_tx_buffers[i], false));
+    }
+
+    verify_critical_section_enter();
+    verify_critical_section_exit();
+
+    TEST_ASSERT_FALSE(nrf_802154_core_transmit_enqueue(m_tx_buffers[NRF_802154_TX_QUEUE_SIZE], false));
+    TEST_ASSERT_EQUAL_UINT8(NRF_802154_TX_QUEUE_SIZE, m_tx_queue_count);
+}
+
+void test_tx_queue_ShallKeepOrderOfFrames(void)
+{
+    tx_queue_entry_t entry;
+
+    // Move the head to verify wrapping around the end of the queue.
+    TEST_ASSERT_TRUE(tx_queue_push(m_tx_buffers[0], false));
+    TEST_ASSERT_TRUE(tx_queue_pop(&entry));
+
+    TEST_ASSERT_TRUE(tx_queue_push(m_tx_buffers[1], true));
+    TEST_ASSERT_TRUE(tx_queue_push(m_tx_buffers[2], false));
+
+    TEST_ASSERT_TRUE(tx_queue_pop(&entry));
+    TEST_ASSERT_EQUAL_PTR(m_tx_buffers[1], entry.p_data);
+    TEST_ASSERT_TRUE(entry.cca);
+
+    TEST_ASSERT_TRUE(tx_queue_pop(&entry));
+    TEST_ASSERT_EQUAL_PTR(m_tx_buffers[2], entry.p_data);
+    TEST_ASSERT_FALSE(entry.cca);
+
+    TEST_ASSERT_FALSE(tx_queue_pop(&entry));
+}
+
+void test_tx_queue_flush_ShallNotifyEveryQueuedFrame(void)
+{
+    for (uint32_t i = 0; i < NRF_802154_TX_QUEUE_SIZE; i++)
+    {
+        TEST_ASSERT_TRUE(tx_queue_push(m_tx_buffers[i], false));
+        verify_transmit_failed_notification(m_tx_buffers[i], NRF_802154_TX_ERROR_ABORTED);
+    }
+
+    tx_queue_flush(NRF_802154_TX_ERROR_ABORTED);
+
+    TEST_ASSERT_EQUAL_UINT8(0, m_tx_queue_count);
+}
+
+void test_next_tx_or_rx_init_ShallPostponeQueuedFrameWithoutTimeslot(void)
+{
+    m_state = RADIO_STATE_TX;
+
+    TEST_ASSERT_TRUE(tx_queue_push(m_tx_buffers[0], true));
+
+    // Timeslot is not granted, so the frame waits for the next timeslot in the transmit state.
+    next_tx_or_rx_init();
+
+    TEST_ASSERT_EQUAL(RADIO_STATE_CCA_TX, m_state);
+    TEST_ASSERT_EQUAL_PTR(m_tx_buffers[0], mp_tx_data);
+    TEST_ASSERT_EQUAL_UINT8(0, m_tx_queue_count);
+}
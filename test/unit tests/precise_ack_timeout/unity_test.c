@@ -0,0 +1,165 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+
+#ifdef NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+#undef NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED
+#endif
+#define NRF_802154_ACK_TIMEOUT_ADAPTIVE_ENABLED 1
+
+#ifdef NRF_802154_ACK_TIMEOUT_ADAPTIVE_WINDOW
+#undef NRF_802154_ACK_TIMEOUT_ADAPTIVE_WINDOW
+#endif
+#define NRF_802154_ACK_TIMEOUT_ADAPTIVE_WINDOW 4
+
+#include "mock_nrf_802154_debug.h"
+#include "mock_nrf_802154_notification.h"
+#include "mock_nrf_802154_request.h"
+#include "mock_nrf_802154_timer_sched.h"
+
+#define __DMB()
+
+#include "nrf_802154_precise_ack_timeout.c"
+
+#define TX_START_TIME 100000UL ///< Time at which the transmissions start [us].
+#define ACK_DELAY     352UL    ///< Delay between the end of a frame and the start of its ACK [us].
+
+static uint8_t m_imm_ack_frame[] = {10, 0x61, 0x98, 0x01, 0xcd, 0xab, 0xff, 0xff, 0x00, 0x00, 0x00};
+static uint8_t m_enh_ack_frame[] = {10, 0x61, 0xa8, 0x01, 0xcd, 0xab, 0xff, 0xff, 0x00, 0x00, 0x00};
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+    memset(&m_imm_ack_delay, 0, sizeof(m_imm_ack_delay));
+    memset(&m_enh_ack_delay, 0, sizeof(m_enh_ack_delay));
+
+    m_timeout             = NRF_802154_PRECISE_ACK_TIMEOUT_DEFAULT_TIMEOUT;
+    m_timeouts            = 0;
+    m_procedure_is_active = false;
+}
+
+void tearDown(void)
+{
+
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+static uint32_t frame_time_get(const uint8_t * p_frame)
+{
+    return nrf_802154_frame_duration_get(p_frame[0], false, true);
+}
+
+static void tx_started(const uint8_t * p_frame)
+{
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(TX_START_TIME);
+    nrf_802154_timer_sched_add_ExpectAndReturn(&m_timer, true, true);
+
+    TEST_ASSERT_TRUE(nrf_802154_ack_timeout_tx_started_hook(p_frame));
+}
+
+static void rx_ack_started(const uint8_t * p_frame, uint32_t delay)
+{
+    nrf_802154_timer_sched_remove_Expect(&m_timer, NULL);
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(TX_START_TIME + frame_time_get(p_frame) + delay);
+
+    nrf_802154_ack_timeout_rx_ack_started_hook();
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void test_AckTimeoutIsDefaultBeforeAnyAckIsMeasured(void)
+{
+    tx_started(m_imm_ack_frame);
+
+    TEST_ASSERT_EQUAL_UINT32(frame_time_get(m_imm_ack_frame) +
+                             NRF_802154_PRECISE_ACK_TIMEOUT_DEFAULT_TIMEOUT +
+                             IMM_ACK_DURATION,
+                             m_timer.dt);
+}
+
+void test_AckTimeoutFollowsMeasuredAckDelayOfTheSameType(void)
+{
+    tx_started(m_imm_ack_frame);
+    rx_ack_started(m_imm_ack_frame, ACK_DELAY);
+
+    tx_started(m_imm_ack_frame);
+    TEST_ASSERT_EQUAL_UINT32(frame_time_get(m_imm_ack_frame) +
+                             ACK_DELAY +
+                             NRF_802154_ACK_TIMEOUT_ADAPTIVE_MARGIN,
+                             m_timer.dt);
+    rx_ack_started(m_imm_ack_frame, ACK_DELAY);
+
+    // Enh-Ack delays were not measured yet.
+    tx_started(m_enh_ack_frame);
+    TEST_ASSERT_EQUAL_UINT32(frame_time_get(m_enh_ack_frame) +
+                             NRF_802154_PRECISE_ACK_TIMEOUT_DEFAULT_TIMEOUT +
+                             IMM_ACK_DURATION,
+                             m_timer.dt);
+}
+
+void test_LongestAckDelayIsForgottenAfterTwoWindows(void)
+{
+    tx_started(m_imm_ack_frame);
+    rx_ack_started(m_imm_ack_frame, ACK_DELAY + 100);
+
+    for (uint32_t i = 1; i < 2 * NRF_802154_ACK_TIMEOUT_ADAPTIVE_WINDOW; i++)
+    {
+        tx_started(m_imm_ack_frame);
+        TEST_ASSERT_EQUAL_UINT32(frame_time_get(m_imm_ack_frame) +
+                                 ACK_DELAY + 100 +
+                                 NRF_802154_ACK_TIMEOUT_ADAPTIVE_MARGIN,
+                                 m_timer.dt);
+        rx_ack_started(m_imm_ack_frame, ACK_DELAY);
+    }
+
+    tx_started(m_imm_ack_frame);
+    TEST_ASSERT_EQUAL_UINT32(frame_time_get(m_imm_ack_frame) +
+                             ACK_DELAY +
+                             NRF_802154_ACK_TIMEOUT_ADAPTIVE_MARGIN,
+                             m_timer.dt);
+
+    TEST_ASSERT_EQUAL_UINT32(2 * NRF_802154_ACK_TIMEOUT_ADAPTIVE_WINDOW,
+                             m_imm_ack_delay.data.samples);
+    TEST_ASSERT_EQUAL_UINT32(ACK_DELAY, m_imm_ack_delay.data.min);
+    TEST_ASSERT_EQUAL_UINT32(ACK_DELAY + 100, m_imm_ack_delay.data.max);
+}
@@ -0,0 +1,126 @@
+/* Copyright (c) 2017 - 2018, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+
+#include "nrf_802154_rx_buffer.c"
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+    nrf_802154_rx_buffer_init();
+}
+
+void tearDown(void)
+{
+
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+// After initialization the first buffer is returned.
+void test_FreeFindReturnsFirstBufferAfterInit()
+{
+    TEST_ASSERT_EQUAL_PTR(&nrf_802154_rx_buffers[0], nrf_802154_rx_buffer_free_find());
+}
+
+// Buffer is not removed from the pool until it is marked as used.
+void test_FreeFindReturnsSameBufferUntilTaken()
+{
+    rx_buffer_t * p_buffer = nrf_802154_rx_buffer_free_find();
+
+    TEST_ASSERT_EQUAL_PTR(p_buffer, nrf_802154_rx_buffer_free_find());
+
+    p_buffer->free = false;
+
+    TEST_ASSERT_EQUAL_PTR(&nrf_802154_rx_buffers[1], nrf_802154_rx_buffer_free_find());
+}
+
+// Buffers are handed out in order and NULL is returned when the pool is exhausted.
+void test_FreeFindReturnsNullWhenAllBuffersTaken()
+{
+    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    {
+        rx_buffer_t * p_buffer = nrf_802154_rx_buffer_free_find();
+
+        TEST_ASSERT_EQUAL_PTR(&nrf_802154_rx_buffers[i], p_buffer);
+        p_buffer->free = false;
+    }
+
+    TEST_ASSERT_NULL(nrf_802154_rx_buffer_free_find());
+}
+
+// Released buffer is found again, also after its bit was dropped as a stale hint.
+void test_ReleasedBufferIsFoundAgain()
+{
+    uint32_t index = NRF_802154_RX_BUFFERS - 1;
+
+    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    {
+        nrf_802154_rx_buffers[i].free = false;
+    }
+
+    TEST_ASSERT_NULL(nrf_802154_rx_buffer_free_find());
+
+    nrf_802154_rx_buffer_release(&nrf_802154_rx_buffers[index]);
+
+    TEST_ASSERT_TRUE(nrf_802154_rx_buffers[index].free);
+    TEST_ASSERT_EQUAL_PTR(&nrf_802154_rx_buffers[index], nrf_802154_rx_buffer_free_find());
+}
+
+// Lowest free index is preferred regardless of the release order.
+void test_LowestReleasedBufferIsPreferred()
+{
+    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    {
+        nrf_802154_rx_buffers[i].free = false;
+    }
+
+    nrf_802154_rx_buffer_release(&nrf_802154_rx_buffers[NRF_802154_RX_BUFFERS - 1]);
+    nrf_802154_rx_buffer_release(&nrf_802154_rx_buffers[0]);
+
+    TEST_ASSERT_EQUAL_PTR(&nrf_802154_rx_buffers[0], nrf_802154_rx_buffer_free_find());
+}
+
+// Stale bits are dropped from the bitmap once a taken buffer is skipped.
+void test_StaleBitIsClearedOnFreeFind()
+{
+    nrf_802154_rx_buffers[0].free = false;
+
+    TEST_ASSERT_EQUAL_PTR(&nrf_802154_rx_buffers[1], nrf_802154_rx_buffer_free_find());
+    TEST_ASSERT_EQUAL_UINT32(0, m_free_bitmap[0] & buffer_bit_get(0));
+}
@@ -0,0 +1,143 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+
+#ifdef NRF_802154_STATS_ENABLED
+#undef NRF_802154_STATS_ENABLED
+#endif
+#define NRF_802154_STATS_ENABLED 1
+
+#include "nrf_802154_stats.c"
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+    nrf_802154_stats_data_reset();
+}
+
+void tearDown(void)
+{
+
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+// After reset no measurement is recorded.
+void test_ResetClearsAllStatistics()
+{
+    nrf_802154_stats_t stats;
+
+    nrf_802154_stats_irq_duration_add(NRF_802154_STATS_IRQ_ID_CRCOK, 100);
+    nrf_802154_stats_data_reset();
+    nrf_802154_stats_data_get(&stats);
+
+    for (uint32_t i = 0; i < NRF_802154_STATS_IRQ_ID_NUM; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT32(0, stats.irq[i].count);
+        TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, stats.irq[i].min);
+        TEST_ASSERT_EQUAL_UINT32(0, stats.irq[i].max);
+
+        for (uint32_t j = 0; j < NRF_802154_STATS_HISTOGRAM_BINS; j++)
+        {
+            TEST_ASSERT_EQUAL_UINT32(0, stats.irq[i].histogram[j]);
+        }
+    }
+}
+
+// Count, minimum and maximum are tracked separately for each IRQ handler part.
+void test_DurationAddUpdatesCountMinAndMax()
+{
+    nrf_802154_stats_t stats;
+
+    nrf_802154_stats_irq_duration_add(NRF_802154_STATS_IRQ_ID_PHYEND, 300);
+    nrf_802154_stats_irq_duration_add(NRF_802154_STATS_IRQ_ID_PHYEND, 100);
+    nrf_802154_stats_irq_duration_add(NRF_802154_STATS_IRQ_ID_PHYEND, 200);
+    nrf_802154_stats_irq_duration_add(NRF_802154_STATS_IRQ_ID_EDEND, 50);
+
+    nrf_802154_stats_data_get(&stats);
+
+    TEST_ASSERT_EQUAL_UINT32(3, stats.irq[NRF_802154_STATS_IRQ_ID_PHYEND].count);
+    TEST_ASSERT_EQUAL_UINT32(100, stats.irq[NRF_802154_STATS_IRQ_ID_PHYEND].min);
+    TEST_ASSERT_EQUAL_UINT32(300, stats.irq[NRF_802154_STATS_IRQ_ID_PHYEND].max);
+
+    TEST_ASSERT_EQUAL_UINT32(1, stats.irq[NRF_802154_STATS_IRQ_ID_EDEND].count);
+    TEST_ASSERT_EQUAL_UINT32(50, stats.irq[NRF_802154_STATS_IRQ_ID_EDEND].min);
+    TEST_ASSERT_EQUAL_UINT32(50, stats.irq[NRF_802154_STATS_IRQ_ID_EDEND].max);
+
+    TEST_ASSERT_EQUAL_UINT32(0, stats.irq[NRF_802154_STATS_IRQ_ID_HANDLER].count);
+}
+
+// Histogram bins double in width and the last bin collects all longer durations.
+void test_DurationAddFillsHistogramBins()
+{
+    nrf_802154_stats_t stats;
+    uint32_t         * p_histogram = stats.irq[NRF_802154_STATS_IRQ_ID_HANDLER].histogram;
+
+    nrf_802154_stats_irq_duration_add(NRF_802154_STATS_IRQ_ID_HANDLER, 0);
+    nrf_802154_stats_irq_duration_add(NRF_802154_STATS_IRQ_ID_HANDLER,
+                                      NRF_802154_STATS_HISTOGRAM_BIN0_LIMIT - 1);
+    nrf_802154_stats_irq_duration_add(NRF_802154_STATS_IRQ_ID_HANDLER,
+                                      NRF_802154_STATS_HISTOGRAM_BIN0_LIMIT);
+    nrf_802154_stats_irq_duration_add(NRF_802154_STATS_IRQ_ID_HANDLER,
+                                      2 * NRF_802154_STATS_HISTOGRAM_BIN0_LIMIT - 1);
+    nrf_802154_stats_irq_duration_add(NRF_802154_STATS_IRQ_ID_HANDLER,
+                                      2 * NRF_802154_STATS_HISTOGRAM_BIN0_LIMIT);
+    nrf_802154_stats_irq_duration_add(NRF_802154_STATS_IRQ_ID_HANDLER, UINT32_MAX);
+
+    nrf_802154_stats_data_get(&stats);
+
+    TEST_ASSERT_EQUAL_UINT32(2, p_histogram[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, p_histogram[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, p_histogram[2]);
+    TEST_ASSERT_EQUAL_UINT32(1, p_histogram[NRF_802154_STATS_HISTOGRAM_BINS - 1]);
+}
+
+// ACK frames are counted separately depending on whether their deadline was met.
+void test_AckAddCountsSentAndMissedAcks()
+{
+    nrf_802154_stats_t stats;
+
+    nrf_802154_stats_ack_add(true);
+    nrf_802154_stats_ack_add(false);
+    nrf_802154_stats_ack_add(true);
+
+    nrf_802154_stats_data_get(&stats);
+
+    TEST_ASSERT_EQUAL_UINT32(2, stats.ack.sent);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.ack.missed);
+}
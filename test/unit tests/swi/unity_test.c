@@ -0,0 +1,362 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "mock_nrf_802154.h"
+#include "mock_nrf_egu.h"
+
+#include "nrf_802154_swi.c"
+
+#define STRESS_SEED       0x802154       ///< Seed making the stress test reproducible.
+#define STRESS_ITERATIONS 1000           ///< Number of requests of the lowest priority context.
+#define PREEMPTION_ODDS   3              ///< One in PREEMPTION_ODDS chance of another preemption.
+#define PRODUCERS_NUM     REQ_QUEUE_SIZE ///< Number of contexts issuing requests.
+#define MAX_REQUESTS      8192           ///< Upper bound of the number of requests in a test.
+
+static uint32_t m_requests_issued;                  ///< Number of requests issued in the test.
+static uint8_t  m_requests_processed[MAX_REQUESTS]; ///< Number of times each request was processed.
+static bool     m_egu_ignored;                      ///< If EGU calls are not verified.
+
+/***********************************************************************************/
+/********************************* CORE FAKES **************************************/
+/***********************************************************************************/
+
+// The SWI module forwards requests to the core. Only energy detection requests are issued by
+// the tests. The duration identifies the request.
+
+bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
+{
+    (void)term_lvl;
+
+    TEST_ASSERT_TRUE(time_us < MAX_REQUESTS);
+    m_requests_processed[time_us]++;
+
+    return true;
+}
+
+bool nrf_802154_core_sleep(nrf_802154_term_t term_lvl)
+{
+    (void)term_lvl;
+    TEST_FAIL();
+    return false;
+}
+
+bool nrf_802154_core_receive(nrf_802154_term_t              term_lvl,
+                             req_originator_t               req_orig,
+                             nrf_802154_notification_func_t notify_function,
+                             bool                           notify_abort)
+{
+    (void)term_lvl;
+    (void)req_orig;
+    (void)notify_function;
+    (void)notify_abort;
+    TEST_FAIL();
+    return false;
+}
+
+bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
+                              req_originator_t               req_orig,
+                              const uint8_t                * p_data,
+                              bool                           cca,
+                              bool                           immediate,
+                              nrf_802154_notification_func_t notify_function)
+{
+    (void)term_lvl;
+    (void)req_orig;
+    (void)p_data;
+    (void)cca;
+    (void)immediate;
+    (void)notify_function;
+    TEST_FAIL();
+    return false;
+}
+
+#if NRF_802154_TX_QUEUE_ENABLED
+bool nrf_802154_core_transmit_enqueue(const uint8_t * p_data, bool cca)
+{
+    (void)p_data;
+    (void)cca;
+    TEST_FAIL();
+    return false;
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
+bool nrf_802154_core_cca(nrf_802154_term_t term_lvl)
+{
+    (void)term_lvl;
+    TEST_FAIL();
+    return false;
+}
+
+bool nrf_802154_core_continuous_carrier(nrf_802154_term_t term_lvl)
+{
+    (void)term_lvl;
+    TEST_FAIL();
+    return false;
+}
+
+bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
+{
+    (void)p_data;
+    TEST_FAIL();
+    return false;
+}
+
+bool nrf_802154_core_channel_update(void)
+{
+    TEST_FAIL();
+    return false;
+}
+
+bool nrf_802154_core_cca_cfg_update(void)
+{
+    TEST_FAIL();
+    return false;
+}
+
+bool nrf_802154_core_rssi_measure(void)
+{
+    TEST_FAIL();
+    return false;
+}
+
+bool nrf_802154_core_last_rssi_measurement_get(int8_t * p_rssi)
+{
+    (void)p_rssi;
+    TEST_FAIL();
+    return false;
+}
+
+void nrf_802154_clock_hfclk_stop(void)
+{
+    // All EGU events are reported as set when EGU calls are ignored.
+    TEST_ASSERT_TRUE(m_egu_ignored);
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+    memset(m_req_queue, 0, sizeof(m_req_queue));
+    memset(m_requests_processed, 0, sizeof(m_requests_processed));
+
+    m_requests_issued = 0;
+    m_egu_ignored     = false;
+}
+
+void tearDown(void)
+{
+
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+/**
+ * Run the SWI handler for a published request, as the SWI preempts the request function.
+ */
+static void swi_irq_handle(void)
+{
+    if (m_egu_ignored)
+    {
+        SWI_IRQHandler();
+        return;
+    }
+
+    nrf_egu_event_check_ExpectAndReturn(SWI_EGU, NTF_EVENT, false);
+    nrf_egu_event_check_ExpectAndReturn(SWI_EGU, HFCLK_STOP_EVENT, false);
+    nrf_egu_event_check_ExpectAndReturn(SWI_EGU, REQ_EVENT, true);
+    nrf_egu_event_clear_Expect(SWI_EGU, REQ_EVENT);
+
+    SWI_IRQHandler();
+}
+
+/**
+ * Reserve a slot for a new request, as a request function does before it is preempted.
+ */
+static nrf_802154_req_data_t * request_reserve(void)
+{
+    nrf_802154_req_data_t * p_slot = req_enter();
+
+    TEST_ASSERT_NOT_NULL(p_slot);
+    TEST_ASSERT_EQUAL_UINT8(REQ_SLOT_STATE_RESERVED, p_slot->state);
+
+    return p_slot;
+}
+
+/**
+ * Fill and publish a reserved slot, and let the SWI process it.
+ */
+static void request_publish(nrf_802154_req_data_t * p_slot, uint32_t id, bool * p_result)
+{
+    TEST_ASSERT_TRUE(id < MAX_REQUESTS);
+
+    p_slot->type                           = REQ_TYPE_ENERGY_DETECTION;
+    p_slot->data.energy_detection.term_lvl = NRF_802154_TERM_NONE;
+    p_slot->data.energy_detection.time_us  = id;
+    p_slot->data.energy_detection.p_result = p_result;
+
+    if (!m_egu_ignored)
+    {
+        nrf_egu_task_trigger_Expect(SWI_EGU, REQ_TASK);
+    }
+
+    req_exit(p_slot);
+
+    swi_irq_handle();
+}
+
+/**
+ * Issue a request from a context of given priority. Contexts of higher priority may preempt
+ * the request function while it holds its slot, and issue requests of their own.
+ */
+static void request_issue(uint32_t priority)
+{
+    uint32_t                id     = m_requests_issued++;
+    bool                    result = false;
+    nrf_802154_req_data_t * p_slot = request_reserve();
+
+    while ((priority + 1 < PRODUCERS_NUM) && ((rand() % PREEMPTION_ODDS) == 0))
+    {
+        request_issue(priority + 1);
+    }
+
+    request_publish(p_slot, id, &result);
+
+    TEST_ASSERT_TRUE(result);
+    TEST_ASSERT_EQUAL_UINT8(1, m_requests_processed[id]);
+}
+
+static void all_slots_free_verify(void)
+{
+    for (uint32_t i = 0; i < REQ_QUEUE_SIZE; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT8(REQ_SLOT_STATE_FREE, m_req_queue[i].state);
+    }
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+// Requests issued while other request functions are preempted with reserved slots are processed
+// and free their slots, however many of them are issued.
+void test_PreemptedRequestsDoNotBlockFreedSlots(void)
+{
+    nrf_802154_req_data_t * p_preempted[REQ_QUEUE_SIZE - 1];
+    bool                    preempted_result[REQ_QUEUE_SIZE - 1] = {false};
+
+    for (uint32_t i = 0; i < REQ_QUEUE_SIZE - 1; i++)
+    {
+        p_preempted[i] = request_reserve();
+        m_requests_issued++;
+    }
+
+    for (uint32_t i = 0; i < 4 * REQ_QUEUE_SIZE; i++)
+    {
+        bool result = false;
+
+        request_publish(request_reserve(), m_requests_issued, &result);
+
+        TEST_ASSERT_TRUE(result);
+        TEST_ASSERT_EQUAL_UINT8(1, m_requests_processed[m_requests_issued]);
+
+        m_requests_issued++;
+    }
+
+    for (uint32_t i = 0; i < REQ_QUEUE_SIZE - 1; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT8(0, m_requests_processed[i]);
+
+        request_publish(p_preempted[i], i, &preempted_result[i]);
+
+        TEST_ASSERT_TRUE(preempted_result[i]);
+        TEST_ASSERT_EQUAL_UINT8(1, m_requests_processed[i]);
+    }
+
+    all_slots_free_verify();
+}
+
+// A request published out of order, after requests from slots following its own, is processed.
+void test_RequestPublishedOutOfOrderIsProcessed(void)
+{
+    bool result_first  = false;
+    bool result_second = false;
+
+    nrf_802154_req_data_t * p_first  = request_reserve();
+    nrf_802154_req_data_t * p_second = request_reserve();
+
+    request_publish(p_second, 1, &result_second);
+    TEST_ASSERT_TRUE(result_second);
+    TEST_ASSERT_FALSE(result_first);
+
+    request_publish(p_first, 0, &result_first);
+    TEST_ASSERT_TRUE(result_first);
+
+    TEST_ASSERT_EQUAL_UINT8(1, m_requests_processed[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, m_requests_processed[1]);
+
+    all_slots_free_verify();
+}
+
+// Concurrent producers of every priority, preempting each other at random while they hold their
+// slots, get each request processed exactly once without running out of slots.
+void test_ConcurrentProducersStress(void)
+{
+    // Expectations for every EGU call of thousands of requests would not fit in CMock memory.
+    // The SWI handler sees every EGU event set and finds the notification queue empty.
+    m_egu_ignored = true;
+    nrf_egu_event_check_IgnoreAndReturn(true);
+    nrf_egu_event_clear_Ignore();
+    nrf_egu_task_trigger_Ignore();
+
+    srand(STRESS_SEED);
+
+    for (uint32_t i = 0; i < STRESS_ITERATIONS; i++)
+    {
+        request_issue(0);
+        all_slots_free_verify();
+    }
+
+    TEST_ASSERT_TRUE(m_requests_issued < MAX_REQUESTS);
+
+    for (uint32_t i = 0; i < m_requests_issued; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT8(1, m_requests_processed[i]);
+    }
+}